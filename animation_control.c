@@ -0,0 +1,333 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Code for LED animations: blinking, pulsing and sweeping squares, and
+ * showing a move, a frame at a time on Timer1_A ticks.
+ */
+#include <msp430g2553.h>
+#include <serial_led_control.h>
+#include <button_control.h>
+#include <chess_functions.h>
+#include <animation_control.h>
+
+#define ANIMATION_NONE  0
+#define ANIMATION_BLINK 1
+#define ANIMATION_PULSE 2
+#define ANIMATION_SWEEP 3
+#define ANIMATION_MOVE  4
+
+/*
+ * Global brightness of the squares a sweep or move lights, and of the
+ * square a move leaves behind.
+ */
+#define ANIMATION_BRIGHT 16
+#define ANIMATION_DIM    4
+
+/*
+ * A point in a looping animation: how far through the period it is, out of
+ * 255, and the global brightness there. The last keyframe is at 255.
+ */
+typedef struct {
+    unsigned char at;
+    unsigned char level;
+} keyframe_t;
+
+/*
+ * A blink holds each level until the next keyframe, a pulse fades between
+ * them.
+ */
+static const keyframe_t blink_frames[] = { { 0, 1 }, { 128, 0 }, { 255, 0 } };
+static const keyframe_t pulse_frames[] = { { 0, 1 }, { 128, 31 }, { 255, 1 } };
+
+/*
+ * Ticks counted by the Timer1_A interrupt while an animation runs.
+ */
+static volatile unsigned int animation_ticks = 0;
+
+/*
+ * The animation running: its kind, the squares it lights, their color, its
+ * period in ticks, the tick it started on and the tick last drawn.
+ */
+static unsigned char animation_type = ANIMATION_NONE;
+static unsigned long long animation_mask;
+static unsigned char animation_r;
+static unsigned char animation_g;
+static unsigned char animation_b;
+static unsigned char animation_period;
+static unsigned int animation_start;
+static unsigned int animation_drawn;
+
+/*
+ * The squares a move animation goes between.
+ */
+static unsigned char animation_from;
+static unsigned char animation_to;
+
+static void start_animation(int type, unsigned long long mask,
+                            unsigned char r_val, unsigned char g_val,
+                            unsigned char b_val, unsigned int period_ms);
+static int keyframe_level(const keyframe_t *frames, int fade,
+                          unsigned int elapsed);
+static void draw_squares(unsigned long long mask, int level);
+static void draw_sweep(unsigned int elapsed);
+static void draw_move(unsigned int elapsed);
+static void draw_square(int square, int level);
+
+/*
+ * Blink the squares set in the mask (bit x * 8 + y for each square), on
+ * for the first half of each period and off for the second, until the
+ * animation is stopped or another one started.
+ */
+void blink_squares(unsigned long long mask, unsigned char r_val,
+                   unsigned char g_val, unsigned char b_val,
+                   unsigned int period_ms) {
+    start_animation(ANIMATION_BLINK, mask, r_val, g_val, b_val, period_ms);
+}
+
+/*
+ * Pulse the squares set in the mask, fading them up to full brightness and
+ * back down once per period, until the animation is stopped or another one
+ * started.
+ */
+void pulse_squares(unsigned long long mask, unsigned char r_val,
+                   unsigned char g_val, unsigned char b_val,
+                   unsigned int period_ms) {
+    start_animation(ANIMATION_PULSE, mask, r_val, g_val, b_val, period_ms);
+}
+
+/*
+ * Sweep across the squares set in the mask once, lighting a row of them at
+ * a time from row 0 to row 7, and leave them all off.
+ */
+void sweep_squares(unsigned long long mask, unsigned char r_val,
+                   unsigned char g_val, unsigned char b_val,
+                   unsigned int period_ms) {
+    start_animation(ANIMATION_SWEEP, mask, r_val, g_val, b_val, period_ms);
+}
+
+/*
+ * Show a move by lighting the squares from one square to another a step at
+ * a time, then leave the square moved from lit dimly and the square moved
+ * to brightly. A knight goes straight to the end.
+ */
+void animate_move(int from, int to, unsigned char r_val,
+                  unsigned char g_val, unsigned char b_val,
+                  unsigned int period_ms) {
+    animation_from = from;
+    animation_to = to;
+    start_animation(ANIMATION_MOVE, 0, r_val, g_val, b_val, period_ms);
+}
+
+/*
+ * Stop the animation, leaving the LEDs as its last frame left them.
+ */
+void stop_animation() {
+    TA1CCTL0 &= ~CCIE;
+    animation_type = ANIMATION_NONE;
+}
+
+/*
+ * Returns: 1 while an animation is running, 0 if not
+ */
+int animation_running() {
+    return animation_type != ANIMATION_NONE;
+}
+
+/*
+ * Draw the frame due, if a tick has passed since the last one was drawn,
+ * and send it to the LEDs. Frames are worked out from the ticks since the
+ * animation started, so one drawn late is still the right one. Call from
+ * the main loop whenever it wakes.
+ */
+void update_animation() {
+    unsigned int tick = animation_ticks;
+    unsigned int elapsed = tick - animation_start;
+
+    if (animation_type == ANIMATION_NONE || tick == animation_drawn) return;
+    animation_drawn = tick;
+
+    switch (animation_type) {
+        case ANIMATION_BLINK:
+            draw_squares(animation_mask, keyframe_level(blink_frames, 0, elapsed));
+            break;
+        case ANIMATION_PULSE:
+            draw_squares(animation_mask, keyframe_level(pulse_frames, 1, elapsed));
+            break;
+        case ANIMATION_SWEEP:
+            draw_sweep(elapsed);
+            break;
+        case ANIMATION_MOVE:
+            draw_move(elapsed);
+            break;
+    }
+    send_serial_led_commands();
+}
+
+/*
+ * Timer1_A CCR0 interrupt vector. Counts off a tick and wakes the main loop
+ * to draw the next frame. Only enabled while an animation runs.
+ */
+#pragma vector=TIMER1_A0_VECTOR
+__interrupt void timer1_a0_interrupt (void) {
+    animation_ticks++;
+    __bic_SR_register_on_exit(LPM0_bits);
+}
+
+/*
+ * Perform all the required initial setup for this module:
+ *     Setup Timer1_A to count animation ticks from SMCLK.
+ *     Enable global interrupts.
+ */
+void animation_control_setup() {
+    // Count SMCLK / 8 = 1MHz up to a tick (main clock assumed to be 8MHz),
+    // with the interrupt left off until an animation starts:
+    TA1CCR0 = ANIMATION_TICK_MS * 1000 - 1;
+    TA1CCTL0 = 0;
+    TA1CTL = TASSEL_2 + ID_3 + MC_1 + TACLR;
+
+    // Enable global interrupts:
+    __enable_interrupt();
+}
+
+/*
+ * Start an animation of the given kind, drawing its first frame at the
+ * next update_animation().
+ */
+static void start_animation(int type, unsigned long long mask,
+                            unsigned char r_val, unsigned char g_val,
+                            unsigned char b_val, unsigned int period_ms) {
+    unsigned int period = period_ms / ANIMATION_TICK_MS;
+
+    if (period < 1) period = 1;
+    if (period > 255) period = 255;
+
+    TA1CCTL0 &= ~CCIE;
+    animation_type = type;
+    animation_mask = mask;
+    animation_r = r_val;
+    animation_g = g_val;
+    animation_b = b_val;
+    animation_period = period;
+    animation_start = animation_ticks;
+    animation_drawn = animation_start - 1;
+    TA1CCTL0 |= CCIE;
+}
+
+/*
+ * Works out the brightness of a looping animation from its keyframes,
+ * holding each keyframe's level until the next or fading between them.
+ *
+ * Returns: the global brightness, 0 for off
+ */
+static int keyframe_level(const keyframe_t *frames, int fade,
+                          unsigned int elapsed) {
+    // period is at most 255 ticks, so this stays within 16 bits
+    unsigned int phase = (elapsed % animation_period) * 256 / animation_period;
+    int i = 0;
+
+    while (phase > frames[i + 1].at) i++;
+
+    if (!fade) return frames[i].level;
+    return frames[i].level + ((int) frames[i + 1].level - frames[i].level) *
+           (int) (phase - frames[i].at) / (frames[i + 1].at - frames[i].at);
+}
+
+/*
+ * Lights every square set in the mask at the given brightness, or turns
+ * them off for 0. Walks the mask a byte at a time so empty rows cost a
+ * single test.
+ */
+static void draw_squares(unsigned long long mask, int level) {
+    unsigned char row;
+    int x_pos;
+    int y_pos;
+
+    for (x_pos = 0; mask; x_pos++, mask >>= 8) {
+        row = mask & 0xFF;
+        for (y_pos = 0; row; y_pos++, row >>= 1) {
+            if (row & 1) draw_square(x_pos * 8 + y_pos, level);
+        }
+    }
+}
+
+/*
+ * Lights the row of the mask the sweep has got to and turns the rest off,
+ * ending the sweep once it is past row 7.
+ */
+static void draw_sweep(unsigned int elapsed) {
+    unsigned int step = animation_period >> 3;
+    unsigned int lit_row;
+    unsigned long long row_mask = 0xFF;
+    int x_pos;
+
+    if (step < 1) step = 1;
+    lit_row = elapsed / step;
+
+    for (x_pos = 0; x_pos < 8; x_pos++, row_mask <<= 8) {
+        draw_squares(animation_mask & row_mask,
+                     (unsigned int) x_pos == lit_row ? ANIMATION_BRIGHT : 0);
+    }
+
+    if (lit_row >= 8) stop_animation();
+}
+
+/*
+ * Lights the squares of the move up to the one it has got to, or, once it
+ * has got to the end, only its two ends, which ends the animation.
+ */
+static void draw_move(unsigned int elapsed) {
+    int from_x = SQUARE_X(animation_from);
+    int from_y = SQUARE_Y(animation_from);
+    int dx = SQUARE_X(animation_to) - from_x;
+    int dy = SQUARE_Y(animation_to) - from_y;
+    int steps = dx < 0 ? -dx : dx;
+    unsigned int step;
+    unsigned int reached;
+    int i;
+
+    if ((dy < 0 ? -dy : dy) > steps) steps = dy < 0 ? -dy : dy;
+    if (dx && dy && dx != dy && dx != -dy) {
+        // a knight jumps, it doesn't pass over anything
+        steps = 1;
+        dx = 0;
+        dy = 0;
+    } else {
+        dx = (dx > 0) - (dx < 0);
+        dy = (dy > 0) - (dy < 0);
+    }
+
+    // a frame for each square of the move, and one for the ends
+    step = animation_period / (steps + 1);
+    if (step < 1) step = 1;
+    reached = elapsed / step;
+
+    if (reached < (unsigned int) steps) {
+        for (i = 0; i <= (int) reached; i++) {
+            draw_square(SQUARE(from_x + i * dx, from_y + i * dy), ANIMATION_DIM);
+        }
+        return;
+    }
+
+    for (i = 1; i < steps; i++) {
+        draw_square(SQUARE(from_x + i * dx, from_y + i * dy), 0);
+    }
+    draw_square(animation_from, ANIMATION_DIM);
+    draw_square(animation_to, ANIMATION_BRIGHT);
+    stop_animation();
+}
+
+/*
+ * Lights a square in the animation's color at the given brightness, or
+ * turns it off for 0.
+ */
+static void draw_square(int square, int level) {
+    int led = get_led_id(SQUARE_X(square), SQUARE_Y(square));
+
+    if (level) {
+        set_serial_led_color(led, level, animation_r, animation_g, animation_b);
+    } else {
+        set_serial_led_color(led, 0, 0, 0, 0);
+    }
+}
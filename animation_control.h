@@ -0,0 +1,79 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for LED animations: blinking, pulsing and sweeping squares,
+ * and showing a move, a frame at a time on Timer1_A ticks.
+ */
+#ifndef CHESS_ANIMATION_CONTROL
+#define CHESS_ANIMATION_CONTROL
+
+/*
+ * Time between animation frames, in milliseconds. Periods are counted in
+ * these ticks, so they are rounded to a multiple of it, and can be at most
+ * 255 ticks long.
+ */
+#define ANIMATION_TICK_MS 20
+
+/*
+ * Perform all the required initial setup for this module:
+ *     Setup Timer1_A to count animation ticks from SMCLK.
+ *     Enable global interrupts.
+ */
+void animation_control_setup();
+
+/*
+ * Blink the squares set in the mask (bit x * 8 + y for each square), on
+ * for the first half of each period and off for the second, until the
+ * animation is stopped or another one started.
+ */
+void blink_squares(unsigned long long mask, unsigned char r_val,
+                   unsigned char g_val, unsigned char b_val,
+                   unsigned int period_ms);
+
+/*
+ * Pulse the squares set in the mask, fading them up to full brightness and
+ * back down once per period, until the animation is stopped or another one
+ * started.
+ */
+void pulse_squares(unsigned long long mask, unsigned char r_val,
+                   unsigned char g_val, unsigned char b_val,
+                   unsigned int period_ms);
+
+/*
+ * Sweep across the squares set in the mask once, lighting a row of them at
+ * a time from row 0 to row 7, and leave them all off.
+ */
+void sweep_squares(unsigned long long mask, unsigned char r_val,
+                   unsigned char g_val, unsigned char b_val,
+                   unsigned int period_ms);
+
+/*
+ * Show a move by lighting the squares from one square to another a step at
+ * a time, then leave the square moved from lit dimly and the square moved
+ * to brightly. A knight goes straight to the end.
+ */
+void animate_move(int from, int to, unsigned char r_val,
+                  unsigned char g_val, unsigned char b_val,
+                  unsigned int period_ms);
+
+/*
+ * Stop the animation, leaving the LEDs as its last frame left them.
+ */
+void stop_animation();
+
+/*
+ * Returns: 1 while an animation is running, 0 if not
+ */
+int animation_running();
+
+/*
+ * Draw the frame due, if a tick has passed since the last one was drawn,
+ * and send it to the LEDs. Frames are worked out from the ticks since the
+ * animation started, so one drawn late is still the right one. Call from
+ * the main loop whenever it wakes.
+ */
+void update_animation();
+
+#endif /* CHESS_ANIMATION_CONTROL */
@@ -18,9 +18,10 @@ unsigned int button_state = 0x0000;
 
 /*
  * This array keeps track of how many WDT interrupts the button has been
- * pressed/released. The ports and pins are in numeric order.
+ * pressed/released, indexed by pin: the low nibble counts for the port 2
+ * line, the high nibble for the port 3 line.
  */
-unsigned char debounce_count[16];
+unsigned char debounce_count[8];
 
 /*
  * Holds the value currently in button_state as two unsigned integers,
@@ -31,6 +32,12 @@ unsigned char debounce_count[16];
 int active_button_x = -1;
 int active_button_y = -1;
 
+/*
+ * Set whenever the active button changes, for code that runs too long to
+ * wait in LPM0 to notice. Only ever cleared by that code.
+ */
+volatile unsigned char button_event = 0;
+
 /*
  * Updates the active button integers above.
  */
@@ -117,15 +124,16 @@ __interrupt void wdt_interrupt (void) {
                 (!(P2IN & input_mask) && !(button_state & debounce_mask))) {
             // Button debounce in progress, increment counter
             debounce_count[i]++;
-        } else if (debounce_count[i]) {
+        } else if (debounce_count[i] & 0x0F) {
             // Button has bounced, restart count
-            debounce_count[i] = 0;
+            debounce_count[i] &= 0xF0;
         }
         // Check if debounce complete
-        if (debounce_count[i] == BUTTON_DEBOUNCE_TIME) {
+        if ((debounce_count[i] & 0x0F) == BUTTON_DEBOUNCE_TIME) {
             button_state ^= debounce_mask;
-            debounce_count[i] = 0;
+            debounce_count[i] &= 0xF0;
             if (update_active_button()) {
+                button_event = 1;
                 __bic_SR_register_on_exit(LPM0_bits);
             }
         }
@@ -138,16 +146,17 @@ __interrupt void wdt_interrupt (void) {
         if (((P3IN & input_mask) && (button_state & debounce_mask)) ||
                 (!(P3IN & input_mask) && !(button_state & debounce_mask))) {
             // Button debounce in progress, increment counter
-            debounce_count[i + 8]++;
-        } else if (debounce_count[i + 8]) {
+            debounce_count[i] += 0x10;
+        } else if (debounce_count[i] & 0xF0) {
             // Button has bounced, restart count
-            debounce_count[i + 8] = 0;
+            debounce_count[i] &= 0x0F;
         }
         // Check if debounce complete
-        if (debounce_count[i + 8] == BUTTON_DEBOUNCE_TIME) {
+        if ((debounce_count[i] >> 4) == BUTTON_DEBOUNCE_TIME) {
             button_state ^= debounce_mask;
-            debounce_count[i + 8] = 0;
+            debounce_count[i] &= 0x0F;
             if (update_active_button()) {
+                button_event = 1;
                 __bic_SR_register_on_exit(LPM0_bits);
             }
         }
@@ -10,7 +10,8 @@
 
 /*
  * This defines the minimum amount of time for which a button press is
- * considered real, in milliseconds.
+ * considered real, in milliseconds. At most 15, as each count takes a
+ * nibble.
  */
 #define BUTTON_DEBOUNCE_TIME 10
 
@@ -31,6 +32,12 @@ extern unsigned int button_state;
 extern int active_button_x;
 extern int active_button_y;
 
+/*
+ * Set whenever the active button changes, for code that runs too long to
+ * wait in LPM0 to notice. Only ever cleared by that code.
+ */
+extern volatile unsigned char button_event;
+
 /*
  * Convert an x and y coordinate to an LED id (for use in serial_led_control).
  */
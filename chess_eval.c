@@ -0,0 +1,339 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Position evaluation: material and piece-square tables, blended between
+ * midgame and endgame by the material left, and static exchange evaluation
+ * of captures.
+ */
+#include <chess_functions.h>
+#include <chess_tables.h>
+#include <chess_eval.h>
+
+/*
+ * A piece taking part in an exchange on one square, packed into 3 bytes
+ * (see EXCHANGE_MAX_PIECES).
+ */
+struct exchanger {
+    unsigned char type : 3;
+    unsigned char side : 1;
+    unsigned char ready : 1;  // 1 while it has a clear line to the square
+    unsigned char square;
+    signed char behind;       // index of the slider lined up behind it, or -1
+};
+
+/*
+ * Helper function declarations.
+ */
+static int exchange(const chess_position_t *pos, move_t move, int *contested);
+static int find_exchangers(const chess_position_t *pos, int square, int from,
+                           int taken, struct exchanger *list);
+static int pinned(const chess_position_t *pos, int square, int to, int from,
+                  int taken);
+
+/*
+ * Phase weight of each piece type, by type. The full starting set adds up
+ * to PHASE_TOTAL, so the blend below is a shift rather than a divide.
+ */
+static const unsigned char phase_weight[7] = { 0, 0, 3, 1, 1, 6, 0 };
+
+/*
+ * Plain material value of each piece type for static_exchange(), with the
+ * king worth more than anything it could win.
+ */
+static const short exchange_value[7] = { 0, 100, 500, 320, 330, 900, 20000 };
+
+/**
+ * Blends the running midgame and endgame scores by the game phase. Costs
+ * the same however many pieces are on the board.
+ *
+ * Returns: score of the position in centipawns, for the side to move
+ */
+int evaluate(const chess_position_t *pos) {
+    // promotions can push the phase past the starting total
+    int phase = pos->phase < PHASE_TOTAL ? pos->phase : PHASE_TOTAL;
+    int score = (int) (((long) pos->midgame * phase +
+                        (long) pos->endgame * (PHASE_TOTAL - phase)) >> PHASE_SHIFT);
+
+    return pos->side ? -score : score;
+}
+
+/**
+ * Adds the scores and phase weight of a piece on a square.
+ */
+void add_piece_score(chess_position_t *pos, int piece, int square) {
+    int type = PIECE_TYPE(piece) - 1;
+    int pst_square = PST_SQUARE(piece, square);
+
+    if (PIECE_SIDE(piece)) {
+        pos->midgame -= pst_midgame[type][pst_square];
+        pos->endgame -= pst_endgame[type][pst_square];
+    } else {
+        pos->midgame += pst_midgame[type][pst_square];
+        pos->endgame += pst_endgame[type][pst_square];
+    }
+    pos->phase += phase_weight[type + 1];
+}
+
+/**
+ * Takes away the scores and phase weight of a piece on a square.
+ */
+void remove_piece_score(chess_position_t *pos, int piece, int square) {
+    int type = PIECE_TYPE(piece) - 1;
+    int pst_square = PST_SQUARE(piece, square);
+
+    if (PIECE_SIDE(piece)) {
+        pos->midgame += pst_midgame[type][pst_square];
+        pos->endgame += pst_endgame[type][pst_square];
+    } else {
+        pos->midgame -= pst_midgame[type][pst_square];
+        pos->endgame -= pst_endgame[type][pst_square];
+    }
+    pos->phase -= phase_weight[type + 1];
+}
+
+/**
+ * Works out the scores and phase of the position from scratch. Only needed
+ * when a position is set up by hand; make_move() keeps them current.
+ */
+void reset_score(chess_position_t *pos) {
+    int square;
+    int piece;
+
+    pos->midgame = 0;
+    pos->endgame = 0;
+    pos->phase = 0;
+
+    for (square = 0; square < 64; square++) {
+        piece = PIECE_AT(pos, square);
+        if (piece != PIECE_EMPTY) add_piece_score(pos, piece, square);
+    }
+}
+
+/**
+ * Plays out every capture on the destination square of the move, each side
+ * taking with its least valuable attacker and free to stop whenever going
+ * on would lose material. Checks, and pins past the first recapture, are
+ * not taken into account.
+ *
+ * Returns: material the side to move wins by the move, in centipawns
+ */
+int static_exchange(const chess_position_t *pos, move_t move) {
+    return exchange(pos, move, 0);
+}
+
+/**
+ * Grades a move for a player learning the game by what static_exchange()
+ * makes of it. A move only counts as a trade if the other side can take back
+ * legally without coming out behind.
+ *
+ * Returns: EXCHANGE_LOSES if it gives material away, EXCHANGE_EVEN if the
+ * other side can take back for an equal trade, EXCHANGE_SAFE otherwise
+ */
+int exchange_grade(const chess_position_t *pos, move_t move) {
+    int contested;
+    int gain = exchange(pos, move, &contested);
+
+    if (gain < 0) return EXCHANGE_LOSES;
+    if (gain == 0 && contested) return EXCHANGE_EVEN;
+    return EXCHANGE_SAFE;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+/**
+ *
+ * BELOW IS LIST OF INTERNAL FUNCTIONS, THERE SHOULD BE NO NEED TO CALL THESE
+ *
+ */
+/////////////////////////////////////////////////////////////////////////////
+
+
+
+/**
+ * Works out static_exchange() of the move and, if contested isn't 0,
+ * whether the other side's best first recapture at least breaks even. The
+ * attackers are gathered once, so the cost is one walk out from the square
+ * plus a pass over at most EXCHANGE_MAX_PIECES pieces per capture. Only the
+ * first recapture is checked for a pin.
+ *
+ * Returns: material the side to move wins by the move, in centipawns
+ */
+static int exchange(const chess_position_t *pos, move_t move, int *contested) {
+    struct exchanger list[EXCHANGE_MAX_PIECES];
+    short gain[EXCHANGE_MAX_PIECES + 1];
+    int to = MOVE_TO(move);
+    int side = pos->side;
+    int on_square = PIECE_TYPE(PIECE_AT(pos, MOVE_FROM(move)));
+    int taken = NO_SQUARE;
+    int count;
+    int depth = 0;
+    int captures;
+    int best;
+    int i;
+
+    if (MOVE_FLAGS(move) == MOVE_EN_PASSANT) {
+        taken = to + (side ? 8 : -8);
+        gain[0] = exchange_value[PIECE_PAWN];
+    } else {
+        gain[0] = exchange_value[PIECE_TYPE(PIECE_AT(pos, to))];
+    }
+    if (MOVE_IS_PROMOTION(move)) {
+        on_square = MOVE_PROMOTION_PIECE(move);
+        gain[0] += exchange_value[on_square] - exchange_value[PIECE_PAWN];
+    }
+
+    count = find_exchangers(pos, to, MOVE_FROM(move), taken, list);
+
+    while (1) {
+        side = 1 - side;
+
+        // the cheapest piece with a clear line takes next
+        best = -1;
+        for (i = 0; i < count; i++) {
+            if (!list[i].ready || list[i].side != side) continue;
+            if (best >= 0 &&
+                    exchange_value[list[i].type] >= exchange_value[list[best].type]) {
+                continue;
+            }
+            if (depth == 0 && list[i].type != PIECE_KING &&
+                    pinned(pos, list[i].square, to, MOVE_FROM(move), taken)) {
+                continue;
+            }
+            best = i;
+        }
+        if (best < 0) break;
+
+        depth++;
+        gain[depth] = exchange_value[on_square] - gain[depth - 1];
+        on_square = list[best].type;
+
+        // it leaves the square, so the slider behind it can follow
+        list[best].ready = 0;
+        if (list[best].behind >= 0) list[list[best].behind].ready = 1;
+    }
+
+    // each side stops taking as soon as it would do better not to
+    captures = depth;
+    while (depth > 0) {
+        if (gain[depth] > -gain[depth - 1]) gain[depth - 1] = -gain[depth];
+        depth--;
+    }
+
+    // gain[1] is now what the first recapture is worth to the other side
+    if (contested) *contested = captures > 0 && gain[1] >= 0;
+    return gain[0];
+}
+
+/**
+ * Lists every piece that attacks the square, or would once the pieces in
+ * front of it on the same line have taken, treating the from and taken
+ * squares as empty. Stops at EXCHANGE_MAX_PIECES pieces.
+ *
+ * Returns: number of pieces listed
+ */
+static int find_exchangers(const chess_position_t *pos, int square, int from,
+                           int taken, struct exchanger *list) {
+    const unsigned char *target;
+    int count = 0;
+    int new_square;
+    int previous;
+    int piece;
+    int type;
+    int side;
+    int i;
+    int j;
+
+    for (i = 0; i < 8; i++) {
+        new_square = square;
+        previous = -1;
+
+        for (j = ray_length[square][i]; j > 0 && count < EXCHANGE_MAX_PIECES; j--) {
+            new_square += direction_offset[i];
+            if (new_square == from || new_square == taken) continue;
+
+            piece = PIECE_AT(pos, new_square);
+            if (piece == PIECE_EMPTY) continue;
+
+            // sliders along the line, or a king or pawn right next to the square
+            type = PIECE_TYPE(piece);
+            side = PIECE_SIDE(piece);
+            if (type != PIECE_QUEEN && type != (i < 4 ? PIECE_ROOK : PIECE_BISHOP)) {
+                if (new_square != square + direction_offset[i]) break;
+                if (type == PIECE_PAWN && (i < 4 + 2 * (1 - side) ||
+                        i >= 6 + 2 * (1 - side))) {
+                    break;
+                }
+                if (type != PIECE_PAWN && type != PIECE_KING) break;
+            }
+
+            list[count].type = type;
+            list[count].side = side;
+            list[count].square = new_square;
+            list[count].behind = -1;
+            list[count].ready = previous < 0;
+            if (previous >= 0) list[previous].behind = count;
+            previous = count++;
+        }
+    }
+
+    for (target = knight_targets[square]; *target != NO_SQUARE; target++) {
+        piece = PIECE_AT(pos, *target);
+        if (PIECE_TYPE(piece) != PIECE_KNIGHT || *target == from) continue;
+        if (count == EXCHANGE_MAX_PIECES) break;
+
+        list[count].type = PIECE_KNIGHT;
+        list[count].side = PIECE_SIDE(piece);
+        list[count].square = *target;
+        list[count].behind = -1;
+        list[count].ready = 1;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Checks whether the piece on square is pinned to its king, once the piece
+ * on from has moved to to and the piece on taken is gone, by a slider it
+ * would no longer block after taking on to.
+ *
+ * Returns: 1 if taking on to would leave its king in check, 0 if not
+ */
+static int pinned(const chess_position_t *pos, int square, int to, int from,
+                  int taken) {
+    int side = PIECE_SIDE(PIECE_AT(pos, square));
+    int king = KING_SQUARE(pos, side);
+    int new_square;
+    int found;
+    int piece;
+    int type;
+    int i;
+    int j;
+
+    for (i = 0; i < 8; i++) {
+        new_square = king;
+        found = 0;
+
+        for (j = ray_length[king][i]; j > 0; j--) {
+            new_square += direction_offset[i];
+            if (new_square == to) break;
+            if (new_square == from || new_square == taken) continue;
+
+            piece = PIECE_AT(pos, new_square);
+            if (piece == PIECE_EMPTY) continue;
+            if (new_square == square) {
+                found = 1;
+                continue;
+            }
+            if (!found) break;
+
+            type = PIECE_TYPE(piece);
+            return PIECE_SIDE(piece) != side && (type == PIECE_QUEEN ||
+                    type == (i < 4 ? PIECE_ROOK : PIECE_BISHOP));
+        }
+        if (found) return 0;
+    }
+    return 0;
+}
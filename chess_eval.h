@@ -0,0 +1,81 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for the position evaluation: material and piece-square
+ * tables, blended between midgame and endgame by the material left, and
+ * static exchange evaluation of captures.
+ */
+#ifndef CHESS_EVAL
+#define CHESS_EVAL
+
+#include <chess_functions.h>
+
+/*
+ * Game phase, counted from the pieces on the board: a knight or bishop is
+ * worth 1, a rook 3 and a queen 6, so the starting position has
+ * PHASE_TOTAL and bare kings 0. The total is a power of two so the blend
+ * divides by shifting.
+ */
+#define PHASE_TOTAL 32
+#define PHASE_SHIFT 5
+
+/**
+ * Blends the running midgame and endgame scores by the game phase. Costs
+ * the same however many pieces are on the board.
+ *
+ * Returns: score of the position in centipawns, for the side to move
+ */
+int evaluate(const chess_position_t *pos);
+
+/**
+ * Adds or takes away the scores and phase weight of a piece on a square.
+ * make_move() calls these for every piece it puts down or picks up.
+ */
+void add_piece_score(chess_position_t *pos, int piece, int square);
+void remove_piece_score(chess_position_t *pos, int piece, int square);
+
+/**
+ * Works out the scores and phase of the position from scratch. Only needed
+ * when a position is set up by hand; make_move() keeps them current.
+ */
+void reset_score(chess_position_t *pos);
+
+/**
+ * Plays out every capture on the destination square of the move, each side
+ * taking with its least valuable attacker and free to stop whenever going
+ * on would lose material. Checks, and pins past the first recapture, are
+ * not taken into account.
+ *
+ * Returns: material the side to move wins by the move, in centipawns
+ */
+int static_exchange(const chess_position_t *pos, move_t move);
+
+/*
+ * Grades of exchange_grade(), and the most pieces an exchange looks at.
+ * Each piece takes 5 bytes of stack while static_exchange() runs, the
+ * deepest call of a search, so the MSP430 stops at eight: more lined up on
+ * one square hardly happens.
+ */
+#define EXCHANGE_SAFE  0
+#define EXCHANGE_EVEN  1
+#define EXCHANGE_LOSES 2
+
+#ifdef __MSP430__
+#define EXCHANGE_MAX_PIECES 8
+#else
+#define EXCHANGE_MAX_PIECES 16
+#endif
+
+/**
+ * Grades a move for a player learning the game by what static_exchange()
+ * makes of it. A move only counts as a trade if the other side can take back
+ * legally without coming out behind.
+ *
+ * Returns: EXCHANGE_LOSES if it gives material away, EXCHANGE_EVEN if the
+ * other side can take back for an equal trade, EXCHANGE_SAFE otherwise
+ */
+int exchange_grade(const chess_position_t *pos, move_t move);
+
+#endif /* CHESS_EVAL */
@@ -1,881 +1,1461 @@
-/*
- * Eduardo Berg <eb28@rice.edu>
- * Logan Lawrence <lcl5@rice.edu>
- * Nathaniel Morris <nam6@rice.edu>
- *
- * Generic chess game functions.
- */
-#include <chess_functions.h>
-
-/*
- * Helper function declarations.
- */
-int checkDiagonal(int x_pos, int y_pos);
-int checkRows(int x_pos, int y_pos);
-int checkColumns(int x_pos, int y_pos);
-int checkKnight(int x_pos, int y_pos);
-int verify_move(int orig_x_pos, int orig_y_pos, int new_x_pos, int new_y_pos,
-                int piece, int side);
-int calculate_diagonal_moves(int x_pos, int y_pos, int side, int piece_num,
-                             int king_flag);
-int calculate_vertical_moves(int x_pos, int y_pos, int side, int piece_num,
-                             int king_flag);
-int calculate_horizontal_moves(int x_pos, int y_pos, int side, int piece_num,
-                               int king_flag);
-
-/**
- *
- *	TODO: 
- *  (1) En pessant
- *  (2) Pawn promotion
- *  (3) Castling
- *  (4) Verifying checkmate in a less resource consuming way
- *
- */
-//~//~//~//~//~//~//~//~//~//~//~//~//~//~//~//~//~//~//~//~//
-
-
-/* State of the current game */
-unsigned char currentboard[8][8];
-
-char w_kingSideCastle = 1;
-char w_queenSideCastle = 1;
-char b_kingSideCastle = 1;
-char b_queenSideCastle = 1;
-
-/**
- * Reset the current board back to starting chess orientation.
- * MAKE SURE TO CALL THIS WHEN INITIALIZING BOARD
- */
-void reset_board() {
-    unsigned int i;
-    unsigned int j;
-
-	/* Set all of middle squares to unoccupied */
-	for (i = 2; i < 6; i++) {
-		for (j = 0; j < 8; j++) {
-			currentboard[i][j] = 0;
-		}
-	}
-
-	/* Set up pawns for both sides */
-	for (j = 0; j < 8; j++) {
-		currentboard[1][j] = 1;
-		currentboard[6][j] = 11;
-	}
-
-	/* Set up other pieces */
-	for (j = 0; j < 4; j++) {
-		currentboard[0][j] = j + 2;
-		currentboard[7][j] = j + 12;
-
-		currentboard[0][7 - j] = j + 2;
-		currentboard[7][7 - j] = j + 12;
-		if (j == 3) {
-			currentboard[0][j] = 6;
-			currentboard[7][j] = 16;
-		}
-	}
-}
-
-/**
- * THIS METHOD IS INEFFICIENT
- *
- * Takes in current player side, and returns whether the player is in checkmate
- * or not.
- * Return 1 if in checkmate , 0 if not, -1 if error
- */
-int in_checkmate(int side) {
-    unsigned int i;
-    unsigned int j;
-
-	// go through every piece on board
-	for (i = 0; i < 8; i++) {
-		for (j = 0; j < 8; j++) {
-			if (currentboard[i][j] == 0) continue;
-
-			// if the piece is on players side
-			if ((side == 0 && currentboard[i][j] < 10) ||
-			        (side == 1 && currentboard[i][j] > 10)) {
-
-				// if the player has any possible move, they're not in checkmate
-				if (calculate_moves(i, j, side) > 0) {
-				    revert_board();
-				    return 0;
-				}
-				revert_board();
-			}
-		}
-	}
-
-	return 1;
-}
-
-/**
- * Takes in current player side, and returns whether the player is in check or
- * not.
- * Return 1 if in check, 0 if not, -1 if error
- */
-int in_check(int side) {
-    unsigned int i;
-    unsigned int j;
-
-	for (i = 0; i < 8; i++) {
-		for (j = 0; j < 8; j++) {
-			if (currentboard[i][j] == (side * 10) + 6) {
-				if (checkDiagonal(i, j) || checkRows(i, j) ||
-				        checkColumns(i, j) || checkKnight(i, j)) return 1;
-				return 0;
-			}
-		}
-	}
-
-	// SHOULD NEVER GET TO HERE
-	return -1;
-}
-
-/**
- * Calculates the possible moves of a piece given the position pressed. It does
- * this by altering the state of the current board, where a 1XX value means a
- * move square and 2XX value means a take square
- *
- * REMEMBER TO REVERT TO ORIGINAL UNCALCULATED BOARD USING revert_board()
- * IF THE USER DOESNT CHOOSE TO MOVE SAID PIECE (you dont need to do this if
- * num moves is 0)
- *
- * Returns: num of possible moves
- */
-int calculate_moves(int x_pos, int y_pos, int side) {
-	int temp_piece = 0;
-	int moves = 0;
-
-	int piece = currentboard[x_pos][y_pos];
-	if (piece == 0 || ((side == 1) && (piece <= 10))
-	        || ((side == 0) &&(piece >= 10))) {
-		return 0;
-	}
-
-	// get kind of piece
-	piece = piece % 10;
-
-	int adv_pawn = x_pos + 1 - (2 * side);
-    int adv2_pawn = x_pos + 2*(1 - (2 * side));
-
-	// update tempboard with possible moves
-	switch(piece) {
-		case 1: /* PAWN */
-
-			// pawn moves up single space
-			if ((adv_pawn >= 0) && (adv_pawn < 8) && (currentboard[adv_pawn][y_pos] == 0)) {
-
-				currentboard[adv_pawn][y_pos] = ((side * 10) + piece);
-				currentboard[x_pos][y_pos] = 0;
-				
-				int check = in_check(side);
-				currentboard[x_pos][y_pos] = ((side * 10) + piece);
-				currentboard[adv_pawn][y_pos] = 0;
-
-				if (!check) {
-					currentboard[adv_pawn][y_pos] += 100;
-				}
-
-			}
-
-			// pawn takes to right
-			if ((adv_pawn >= 0) && (adv_pawn < 8) && (y_pos + 1 < 8) &&
-			        ((side == 0  && currentboard[adv_pawn][y_pos + 1] > 10) ||
-			         (side == 1 && currentboard[adv_pawn][y_pos + 1] < 10 && currentboard[adv_pawn][y_pos + 1] != 0))) {
-
-				temp_piece = currentboard[adv_pawn][y_pos + 1];
-				currentboard[adv_pawn][y_pos + 1] = ((side * 10) + piece);
-				currentboard[x_pos][y_pos] = 0;
-				
-				int check = in_check(side);
-				currentboard[x_pos][y_pos] = ((side * 10) + piece);
-				currentboard[adv_pawn][y_pos + 1] = temp_piece;
-
-				if (!check) {
-					currentboard[adv_pawn][y_pos + 1] += 200;
-				}
-
-			}
-
-			// pawn takes to left
-			if ((adv_pawn >= 0) && (adv_pawn < 8) && (y_pos - 1 >= 0) &&
-			        ((side == 0  && currentboard[adv_pawn][y_pos - 1] > 10) ||
-			         (side == 1 && currentboard[adv_pawn][y_pos - 1] < 10 && currentboard[adv_pawn][y_pos - 1] != 0))) {
-
-				temp_piece = currentboard[adv_pawn][y_pos - 1];
-				currentboard[adv_pawn][y_pos - 1] = ((side * 10) + piece);
-				currentboard[x_pos][y_pos] = 0;
-				
-				int check = in_check(side);
-				currentboard[x_pos][y_pos] = ((side * 10) + piece);
-				currentboard[adv_pawn][y_pos - 1] = temp_piece;
-
-				if (!check) {
-					currentboard[adv_pawn][y_pos - 1] += 200;
-				}
-
-			}
-
-			// pawn hasn't been moved yet, can do double space
-			if ((adv2_pawn >= 0) && (adv2_pawn < 8) && (currentboard[adv2_pawn][y_pos] == 0) 
-				&& (((side == 0) && (x_pos == 1)) || ((side == 1) && (x_pos == 6)))) {
-
-				currentboard[adv2_pawn][y_pos] = ((side * 10) + piece);
-				currentboard[x_pos][y_pos] = 0;
-				
-				int check = in_check(side);
-				currentboard[x_pos][y_pos] = ((side * 10) + piece);
-				currentboard[adv2_pawn][y_pos] = 0;
-
-				if (!check) {
-					currentboard[adv2_pawn][y_pos] += 100;
-				}
-			}
-			
-			break;
-		case 2: /* ROOK */
-			moves += calculate_vertical_moves(x_pos, y_pos, side,
-			                                  ((side * 10) + piece), 0);
-			moves += calculate_horizontal_moves(x_pos, y_pos, side,
-			                                    ((side * 10) + piece), 0);
-			break;
-		case 3: /* KNIGHT */
-			if (x_pos + 1 < 8 && y_pos + 2 < 8) {
-				moves += verify_move(x_pos, y_pos, x_pos + 1, y_pos + 2,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos + 2 < 8 && y_pos + 1 < 8) {
-				moves += verify_move(x_pos, y_pos, x_pos + 2, y_pos + 1,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos + 1 < 8 && y_pos - 2 >= 0) {
-				moves += verify_move(x_pos, y_pos, x_pos + 1, y_pos - 2,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos + 2 < 8 && y_pos - 1 >= 0) {
-				moves += verify_move(x_pos, y_pos, x_pos + 2, y_pos - 1,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos - 1 >= 0 && y_pos + 2 < 8) {
-				moves += verify_move(x_pos, y_pos, x_pos - 1, y_pos + 2,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos - 2 >= 0 && y_pos + 1 < 8) {
-				moves += verify_move(x_pos, y_pos, x_pos - 2, y_pos + 1,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos - 1 >= 0 && y_pos - 2 >= 0) {
-				moves += verify_move(x_pos, y_pos, x_pos - 1, y_pos - 2,
-				                     ((side * 10) + piece), side);
-			}
-
-			if (x_pos - 2 >= 0 && y_pos - 1 >= 0) {
-				moves += verify_move(x_pos, y_pos, x_pos - 2, y_pos - 1,
-				                     ((side * 10) + piece), side);
-			}
-			break;
-		case 4: /* BISHOP */
-			moves += calculate_diagonal_moves(x_pos, y_pos, side,
-			                                  ((side * 10) + piece), 0);
-			break;
-		case 5: /* QUEEN */
-			moves += calculate_vertical_moves(x_pos, y_pos, side,
-			                                  ((side * 10) + piece), 0);
-			moves += calculate_horizontal_moves(x_pos, y_pos, side,
-			                                    ((side * 10) + piece), 0);
-			moves += calculate_diagonal_moves(x_pos, y_pos, side,
-			                                  ((side * 10) + piece), 0);
-			break;
-		case 6: /* KING */
-		    if (side == 0 && x_pos == 0 && y_pos == 3 && w_kingSideCastle == 1) {
-                if (currentboard[0][1] == 0 && currentboard[0][2] == 0) {
-                    // modify the board
-                    currentboard[0][2] = 6;
-                    currentboard[0][3] = 0;
-
-                    // if in check, move was invalid
-                    if (!in_check(side)) {
-                        currentboard[0][1] = 6;
-                        currentboard[0][2] = 0;
-                        if (!in_check(side)) {
-                            currentboard[0][1] = 0;
-                            currentboard[0][1] += 100;
-                            currentboard[0][3] = 6;
-                        } else {
-                            currentboard[0][1] = 0;
-                            currentboard[0][3] = 6;
-                        }
-
-                    } else {
-                        currentboard[0][2] = 0;
-                        currentboard[0][3] = 6;
-                    }
-                }
-            }
-		    if (side == 1 && x_pos == 7 && y_pos == 3 && b_kingSideCastle == 1) {
-		        if (currentboard[7][1] == 0 && currentboard[7][2] == 0) {
-		            // modify the board
-                    currentboard[7][2] = 16;
-                    currentboard[7][3] = 0;
-
-                    // if in check, move was invalid
-                    if (!in_check(side)) {
-                        currentboard[7][1] = 16;
-                        currentboard[7][2] = 0;
-                        if (!in_check(side)) {
-                            currentboard[7][1] = 0;
-                            currentboard[7][3] = 16;
-                            currentboard[7][1] += 100;
-                        } else {
-                            currentboard[7][1] = 0;
-                            currentboard[7][3] = 16;
-                        }
-                    } else {
-                        currentboard[7][2] = 0;
-                        currentboard[7][3] = 16;
-                    }
-		        }
-		    }
-		    if (side == 0 && x_pos == 0 && y_pos == 3 && w_queenSideCastle == 1) {
-                if (currentboard[0][4] == 0 && currentboard[0][5] == 0 && currentboard[0][6] == 0) {
-                    // modify the board
-                    currentboard[0][4] = 6;
-                    currentboard[0][3] = 0;
-
-                    // if in check, move was invalid
-                    if (!in_check(side)) {
-                        // modify the board
-                       currentboard[0][5] = 6;
-                       currentboard[0][4] = 0;
-
-                       // if in check, move was invalid
-                       if (!in_check(side)) {
-                           currentboard[0][6] = 6;
-                           currentboard[0][5] = 0;
-                           if (!in_check(side)) {
-                               // revert board
-                               currentboard[0][6] = 0;
-                               currentboard[0][3] = 6;
-                               currentboard[0][5] += 100;
-                           } else {
-                               currentboard[0][6] = 0;
-                               currentboard[0][3] = 6;
-                           }
-                       } else {
-                           currentboard[0][5] = 0;
-                           currentboard[0][3] = 6;
-                       }
-
-                    } else {
-                        currentboard[0][4] = 0;
-                        currentboard[0][3] = 6;
-                    }
-                }
-            }
-		    if (side == 1 && x_pos == 7 && y_pos == 3 && b_queenSideCastle == 1) {
-                if (currentboard[7][4] == 0 && currentboard[7][5] == 0 && currentboard[7][6] == 0) {
-                    // modify the board
-                    currentboard[7][4] = 16;
-                    currentboard[7][3] = 0;
-
-                    // if in check, move was invalid
-                    if (!in_check(side)) {
-                        // modify the board
-                       currentboard[7][5] = 16;
-                       currentboard[7][4] = 0;
-
-                       // if in check, move was invalid
-                       if (!in_check(side)) {
-                           currentboard[7][6] = 16;
-                           currentboard[7][5] = 0;
-                           if (!in_check(side)) {
-                               currentboard[7][6] = 0;
-                               currentboard[7][3] = 16;
-                               currentboard[7][5] += 100;
-                           } else {
-                               currentboard[7][6] = 0;
-                               currentboard[7][3] = 16;
-                           }
-                       } else {
-                           currentboard[7][5] = 0;
-                           currentboard[7][3] = 16;
-                       }
-
-                    } else {
-                        currentboard[7][4] = 0;
-                        currentboard[7][3] = 16;
-                    }
-                }
-            }
-			moves += calculate_vertical_moves(x_pos, y_pos, side,
-			                                  ((side * 10) + piece), 1);
-			moves += calculate_horizontal_moves(x_pos, y_pos, side,
-			                                    ((side * 10) + piece), 1);
-			moves += calculate_diagonal_moves(x_pos, y_pos, side,
-			                                  ((side * 10) + piece), 1);
-			break;
-	}
-	return moves;
-}
-
-/**
- * Revert board to pre-calculated move state. 
- * 
- * NOTE: make sure to call this after using calculate_moves(),
- * plus it's fine to call it more often than not because it wont actually modify
- * that values of any pieces.
- */
-void revert_board() {
-    unsigned int i;
-    unsigned int j;
-
-	for (i = 0; i < 8; i++) {
-		for (j = 0; j < 8; j++) {
-			currentboard[i][j] = currentboard[i][j] % 100;
-		}
-	}
-}
-
-/**
- * Returns the piece id associated with the input position.
- *
- * Returns: piece id at location
- */
-int get_piece_at_pos(int x_pos, int y_pos) {
-	return currentboard[x_pos][y_pos];
-}
-
-/**
- * Request that the piece given by parameter at the original location be moved to the new location.
- *
- * Returns: 1 if the move was successful, 0 if not
- */
-int send_move(int orig_x_pos, int orig_y_pos, int new_x_pos, int new_y_pos, int side) {
-	// error catching
-	if (currentboard[new_x_pos][new_y_pos] < 100) return 0;
-
-	int piece = currentboard[orig_x_pos][orig_y_pos];
-
-	// save the last piece just in case
-	int temp_piece = currentboard[new_x_pos][new_y_pos];
-
-	// modify the board
-	currentboard[new_x_pos][new_y_pos] = piece;
-	currentboard[orig_x_pos][orig_y_pos] = 0;
-	
-	// are you in check after this move?
-	int check = in_check(side);
-
-	// if in check, move was invalid
-	if (check) {
-		// revert board
-		currentboard[orig_x_pos][orig_y_pos] = piece;
-		currentboard[new_x_pos][new_y_pos] = temp_piece;
-		return 0;
-	}
-
-	if (piece % 10 == 6) {
-	    if (side == 0 && w_kingSideCastle == 1 && new_y_pos == 1) {
-	        currentboard[0][0] = 0;
-	        currentboard[0][2] = 2;
-	    }
-
-	    if (side == 1 && b_kingSideCastle == 1 && new_y_pos == 1) {
-            currentboard[7][0] = 0;
-            currentboard[7][2] = 12;
-        }
-
-	    if (side == 0 && w_queenSideCastle == 1 && new_y_pos == 5) {
-            currentboard[0][7] = 0;
-            currentboard[0][4] = 2;
-	    }
-
-	    if (side == 1 && b_queenSideCastle == 1 && new_y_pos == 5) {
-            currentboard[7][7] = 0;
-            currentboard[7][4] = 12;
-        }
-
-	    if (side == 0) {
-	        w_kingSideCastle = 0;
-	        w_queenSideCastle = 0;
-	    } else {
-	        b_kingSideCastle = 0;
-	        b_queenSideCastle = 0;
-	    }
-	}
-
-	if (piece % 10 == 2) {
-	    if (orig_y_pos == 0) {
-	        if (side == 0) w_kingSideCastle = 0;
-	        else b_kingSideCastle = 0;
-	    }
-	    else if (orig_y_pos == 7) {
-	        if (side == 0) w_queenSideCastle = 0;
-	        else b_queenSideCastle = 0;
-	    }
-	}
-
-	if (piece % 10 == 1 && (new_x_pos == 0 || new_x_pos == 7)) {
-	    currentboard[new_x_pos][new_y_pos] = 10 * side + 5;
-	}
-
-	return 1;
-}
-
-
-
-/////////////////////////////////////////////////////////////////////////////
-/**																				
- *
- * BELOW IS LIST OF INTERNAL FUNCTIONS, THERE SHOULD BE NO NEED TO CALL THESE
- *
- */
-/////////////////////////////////////////////////////////////////////////////
-
-
-
-
-
-/**
- * 
- * Calculates whether the king is in check from diagonal.
- * Returns: 1 if in check, 0 if not
- */
-int checkDiagonal(int x_pos, int y_pos) {
-	int side = currentboard[x_pos][y_pos] < 10 ? 0 : 1;
-	int i;
-	int j;
-	int new_x_pos;
-	int new_y_pos;
-	
-	int refval;
-
-	for (i = 0; i < 4; i++) { // outer loop for four diagonals
-		for (j = 1; j < 8; j++) {// inner loop for iterating through diagonals
-		    new_x_pos = x_pos + ((i & 0x01) ? 1 : -1) * j;
-			new_y_pos = y_pos + ((i >= 2) ? 1 : -1) * j;
-
-			if (new_x_pos < 0 || new_x_pos > 7) break;
-			if (new_y_pos < 0 || new_y_pos > 7) break;
-
-			refval = currentboard[new_x_pos][new_y_pos] % 100;
-
-			// if empty space, continue
-			if (refval == 0) continue;
-
-			// if your own piece is on diagonal, check next diagonal
-			if ((refval < 10 && side == 0) 
-				|| (refval > 10 && side == 1)) break;
-
-			// if their piece is on diagonal and not bishop or queen, check next diagonal
-			if (refval != 10 * ((side + 1) % 2) + 4
-				&& refval != 10 * ((side + 1) % 2) + 5
-				&& !(refval == 10 * ((side + 1) % 2) + 1 && new_x_pos + 1 - (2 * ((side + 1) % 2)) == x_pos)) break;
-
-			// only option left is that theres an enemy queen or bishop
-			return 1;
-		}
-	}
-	return 0;
-}
-
-/**
- * Calculates whether the king is in check from rows.
- * Returns: 1 if in check, 0 if not
- */
-int checkRows(int x_pos, int y_pos) {
-    int side = currentboard[x_pos][y_pos] < 10 ? 0 : 1;
-	int i;
-	int j;
-	int new_x_pos;
-
-	int refval;
-
-	for (i = 0; i < 2; i++) { // outer loop for two rows
-		for (j = 1; j < 8; j++) {// inner loop for iterating through rows
-			new_x_pos = x_pos + ((2 * (i % 2) - 1) * j);
-
-			if (new_x_pos < 0 || new_x_pos > 7) break;
-
-			refval = currentboard[new_x_pos][y_pos] % 100;
-
-			// if empty space, continue
-			if (refval == 0) continue;
-
-			// if your own piece is on row, check next row
-			if (refval < 10 && side == 0) break;
-			if (refval > 10 && side == 1) break;
-
-			// if their piece is on row and not rook or queen, check next row
-			if (refval != 10 * ((side + 1) % 2) + 2
-				&& refval != 10 * ((side + 1) % 2) + 5) break;
-
-			// only option left is that theres an enemy rock or queen
-			return 1;
-		}
-	}
-	return 0;
-}
-
-/**
- * Calculates whether the king is in check from columns.
- * Returns: 1 if in check, 0 if not
- */
-int checkColumns(int x_pos, int y_pos) {
-    int side = currentboard[x_pos][y_pos] < 10 ? 0 : 1;
-	int i;
-	int j;
-	int new_y_pos;
-
-	int refval;
-
-	for (i = 0; i < 2; i++) { // outer loop for two rows
-		for (j = 1; j < 8; j++) {// inner loop for iterating through rows
-			new_y_pos = y_pos + ((2 * (i % 2) - 1) * j);
-
-			if (new_y_pos < 0 || new_y_pos > 7) break;
-
-			refval = currentboard[x_pos][new_y_pos] % 100;
-
-			// if empty space, continue
-			if (refval == 0) continue;
-
-			// if your own piece is on row, check next row
-			if (refval < 10 && side == 0) break;
-			if (refval > 10 && side == 1) break;
-
-			// if their piece is on row and not rook or queen, check next row
-			if (refval != 10 * ((side + 1) % 2) + 2
-				&& refval != 10 * ((side + 1) % 2) + 5) break;
-
-			// only option left is that theres an enemy rock or queen
-			return 1;
-		}
-	}
-	return 0;
-}
-
-/**
- * Calculates whether the king is in check from knight.
- * Returns: 1 if in check, 0 if not
- */
-int checkKnight(int x_pos, int y_pos) {
-    int side = currentboard[x_pos][y_pos] < 10 ? 0 : 1;
-
-	if (x_pos + 1 < 8 && y_pos + 2 < 8) {
-		if (currentboard[x_pos + 1][y_pos + 2] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos + 2 < 8 && y_pos + 1 < 8) {
-		if (currentboard[x_pos + 2][y_pos + 1] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos + 1 < 8 && y_pos - 2 >= 0) {
-		if (currentboard[x_pos + 1][y_pos - 2] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos + 2 < 8 && y_pos - 1 >= 0) {
-		if (currentboard[x_pos + 2][y_pos - 1] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos - 1 >= 0 && y_pos + 2 < 8) {
-		if (currentboard[x_pos - 1][y_pos + 2] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos - 2 >= 0 && y_pos + 1 < 8) {
-		if (currentboard[x_pos - 2][y_pos + 1] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos - 1 >= 0 && y_pos - 2 >= 0) {
-		if (currentboard[x_pos - 1][y_pos - 2] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	if (x_pos - 2 >= 0 && y_pos - 1 >= 0) {
-		if (currentboard[x_pos - 2][y_pos - 1] % 100 == 10 * ((side + 1) % 2) + 3) return 1;
-	}
-
-	return 0;
-}
-
-/**
- * When requesting to move to new position, verify the nature of the movement (take or move)
- * and then update board accordingly.
- *
- * Returns: num of moves
- */
-int verify_move(int orig_x_pos, int orig_y_pos, int new_x_pos, int new_y_pos, int piece, int side) {
-
-	// used for when taking a piece
-	int temp_piece;
-
-	// check if the desired space is unoccupied
-	if (currentboard[new_x_pos][new_y_pos] == 0) {
-
-		// modify the board
-		currentboard[new_x_pos][new_y_pos] = piece;
-		currentboard[orig_x_pos][orig_y_pos] = 0;
-		
-		// are you in check after this move?
-		int check = in_check(side);
-
-		// revert board
-		currentboard[orig_x_pos][orig_y_pos] = piece;
-		currentboard[new_x_pos][new_y_pos] = 0;
-
-		// if not in check, make note
-		if (!check) {
-			currentboard[new_x_pos][new_y_pos] += 100;
-			return 1;
-		}
-
-	} else if ((side == 0  && currentboard[new_x_pos][new_y_pos] > 10) || (side == 1 && currentboard[new_x_pos][new_y_pos] < 10)) { // there is a piece in desired space
-
-		// save the value of the taken piece
-		temp_piece = currentboard[new_x_pos][new_y_pos];
-
-		// modify the board
-		currentboard[new_x_pos][new_y_pos] = piece;
-		currentboard[orig_x_pos][orig_y_pos] = 0;
-		
-		// are you in check after this move?
-		int check = in_check(side);
-
-		// revert board
-		currentboard[orig_x_pos][orig_y_pos] = piece;
-		currentboard[new_x_pos][new_y_pos] = temp_piece;
-
-		// if not in check, make note
-		if (!check) {
-			currentboard[new_x_pos][new_y_pos] += 200;
-			return 1;
-		}
-	}
-	return 0;
-}
-
-
-/**
- * Calculate the possile moves a diagonally moving piece, modifying the current board
- *
- * Returns: number of moves
- */
-int calculate_diagonal_moves(int x_pos, int y_pos, int side, int piece_num, int king_flag) {
-	int i;
-	int j;
-	int new_x_pos;
-	int new_y_pos;
-	int moves = 0;
-	int max_num = 8;
-
-	if (king_flag) max_num = 2;
-
-	for (i = 0; i < 4; i++) { // outer loop for four diagonals
-		for (j = 1; j < max_num; j++) {// inner loop for iterating through diagonals
-			new_x_pos = x_pos + ((2 * (i % 2) - 1) * j);
-			new_y_pos = y_pos + ((2 * ((int) (i >= 2)) - 1) * j);
-
-			if (new_x_pos < 0 || new_x_pos > 7) break;
-			if (new_y_pos < 0 || new_y_pos > 7) break;
-
-			// if empty space, verify and continue
-			if (currentboard[new_x_pos][new_y_pos] == 0) {
-				moves += verify_move(x_pos, y_pos, new_x_pos, new_y_pos, piece_num, side);
-				continue;
-			}
-
-			// if your own piece is on diagonal, check next diagonal
-			if (currentboard[new_x_pos][new_y_pos] < 10 && side == 0) break;
-			if (currentboard[new_x_pos][new_y_pos] > 10 && side == 1) break;
-
-			// if their piece is on diagonal, verify and move to next diagonal
-			moves += verify_move(x_pos, y_pos, new_x_pos, new_y_pos, piece_num, side);
-			break;
-		}
-	}
-	return moves;
-}
-
-/**
- * Calculate the possile moves a vertically moving piece, modifying the current board
- *
- * Returns: number of moves
- */
-int calculate_vertical_moves(int x_pos, int y_pos, int side, int piece_num, int king_flag) {
-	int i;
-	int j;
-    int new_y_pos;
-	int moves = 0;
-    int max_num = 8;
-
-	if (king_flag) max_num = 2;
-
-	for (i = 0; i < 2; i++) { // outer loop for four rows
-		for (j = 1; j < max_num; j++) {// inner loop for iterating through rows
-			new_y_pos = y_pos + ((2 * (i % 2) - 1) * j);
-
-			if (new_y_pos < 0 || new_y_pos > 7) break;
-
-			// if empty space, continue
-			if (currentboard[x_pos][new_y_pos] == 0) {
-				moves += verify_move(x_pos, y_pos, x_pos, new_y_pos, piece_num, side);
-				continue;
-			}
-
-			// if your own piece is on row, check next row
-			if (currentboard[x_pos][new_y_pos] < 10 && side == 0) break;
-			if (currentboard[x_pos][new_y_pos] > 10 && side == 1) break;
-
-			// if their piece is on row, verify and move to next row
-			moves += verify_move(x_pos, y_pos, x_pos, new_y_pos, piece_num, side);
-			break;
-		}
-	}
-	return moves;
-}
-
-/**
- * Calculate the possile moves a horizontally moving piece, modifying the current board
- *
- * Returns: number of moves
- */
-int calculate_horizontal_moves(int x_pos, int y_pos, int side, int piece_num, int king_flag) {
-	int i;
-	int j;
-	int new_x_pos;
-	int moves = 0;
-    int max_num = 8;
-
-	if (king_flag) max_num = 2;
-
-	for (i = 0; i < 2; i++) { // outer loop for four rows
-		for (j = 1; j < max_num; j++) {// inner loop for iterating through rows
-			new_x_pos = x_pos + ((2 * (i % 2) - 1) * j);
-
-			if (new_x_pos < 0 || new_x_pos > 7) break;
-
-			// if empty space, continue
-			if (currentboard[new_x_pos][y_pos] == 0) {
-				moves += verify_move(x_pos, y_pos, new_x_pos, y_pos, piece_num, side);
-				continue;
-			}
-
-			// if your own piece is on row, check next row
-			if (currentboard[new_x_pos][y_pos] < 10 && side == 0) break;
-			if (currentboard[new_x_pos][y_pos] > 10 && side == 1) break;
-
-			// if their piece is on row, verify and move to next row
-			moves += verify_move(x_pos, y_pos, new_x_pos, y_pos, piece_num, side);
-			break;
-		}
-	}
-	return moves;
-}
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Generic chess game functions.
+ */
+#include <chess_functions.h>
+#include <chess_tables.h>
+#include <chess_eval.h>
+
+#ifdef CHESS_DEBUG
+#include <assert.h>
+#endif
+
+/*
+ * Helper function declarations.
+ */
+struct legality;
+
+int checkDiagonal(chess_position_t *pos, int square, int side);
+int checkRows(chess_position_t *pos, int square, int side);
+int checkColumns(chess_position_t *pos, int square, int side);
+int checkKnight(chess_position_t *pos, int square, int side);
+int checkKing(chess_position_t *pos, int square, int side);
+static int check_rays(chess_position_t *pos, int square, int side,
+                      int first_dir, int last_dir, int slider);
+static int square_attacked(chess_position_t *pos, int square, int side);
+static void compute_legality(chess_position_t *pos, int side,
+                             struct legality *legal);
+static int add_piece_moves(chess_position_t *pos, int square, int side,
+                           const struct legality *legal, move_t *moves);
+static int add_move(move_t *moves, int num_moves, int from, int to,
+                    int flags, unsigned long long target_mask);
+static int add_pawn_moves(chess_position_t *pos, int square, int side,
+                          unsigned long long target_mask, move_t *moves);
+static int add_step_moves(chess_position_t *pos, int square, int side,
+                          int first_dir, int last_dir,
+                          unsigned long long target_mask, move_t *moves);
+static int add_knight_moves(chess_position_t *pos, int square, int side,
+                            unsigned long long target_mask, move_t *moves);
+static int add_king_moves(chess_position_t *pos, int square, int side,
+                          unsigned long long target_mask, move_t *moves);
+static int add_castling_moves(chess_position_t *pos, int side,
+                              const struct legality *legal, move_t *moves);
+static int castle_allowed(chess_position_t *pos, int side, int queen_side);
+static move_t next_piece_move(chess_position_t *pos, int square, move_t move,
+                              int captures);
+static move_t next_pawn_move(chess_position_t *pos, int square, int side,
+                             move_t move, int captures);
+static move_t next_step_move(chess_position_t *pos, int square, int side,
+                             int first_dir, int last_dir, move_t move,
+                             int captures);
+static move_t next_target_move(chess_position_t *pos, int square, int side,
+                               const unsigned char *target, move_t move,
+                               int captures);
+static move_t next_king_move(chess_position_t *pos, int square, int side,
+                             move_t move, int captures);
+static int king_safe_after(chess_position_t *pos, move_t move);
+static int king_has_move(chess_position_t *pos, int square, int side);
+static int square_reachable(chess_position_t *pos, int square, int side,
+                            const struct legality *legal);
+static int en_passant_legal(chess_position_t *pos, int from, int side);
+static unsigned long long pin_ray(chess_position_t *pos, int king, int square,
+                                  int side);
+static int ray_direction(int from, int to);
+static void put_piece(chess_position_t *pos, int square, int piece);
+static void clear_castle_rights(chess_position_t *pos, int square);
+static void find_kings(chess_position_t *pos);
+
+#define HISTORY_KEY(hash) ((history_key_t) (hash))
+#define ALL_SQUARES 0xFFFFFFFFFFFFFFFFULL
+
+/*
+ * Everything the move generators need to know about checks and pins, worked
+ * out once per position by compute_legality(). A move of any piece but the
+ * king is legal exactly when it lands on check_mask and, for a pinned piece,
+ * on the pin ray holding it, so only king moves still need an attack test.
+ */
+struct legality {
+	int king;                        // square of the side's king
+	int checkers;                    // number of pieces giving check
+	int checker;                     // square of the last checker found
+	int check_dir;                   // direction to a sliding checker, or -1
+	unsigned long long check_mask;   // squares that take or block the checker
+	unsigned long long pinned;       // own pieces pinned against the king
+};
+
+/**
+ * Reset the board back to starting chess orientation, white to move.
+ * MAKE SURE TO CALL THIS WHEN INITIALIZING BOARD
+ */
+void reset_board(chess_position_t *pos) {
+    unsigned int i;
+    unsigned int j;
+
+	/* Set all of middle squares to unoccupied */
+	for (i = 2; i < 6; i++) {
+		for (j = 0; j < 8; j++) {
+			put_piece(pos, SQUARE(i, j), 0);
+		}
+	}
+
+	/* Set up pawns for both sides */
+	for (j = 0; j < 8; j++) {
+		put_piece(pos, SQUARE(1, j), MAKE_PIECE(0, PIECE_PAWN));
+		put_piece(pos, SQUARE(6, j), MAKE_PIECE(1, PIECE_PAWN));
+	}
+
+	/* Set up other pieces */
+	for (j = 0; j < 4; j++) {
+		put_piece(pos, SQUARE(0, j), MAKE_PIECE(0, j + 2));
+		put_piece(pos, SQUARE(7, j), MAKE_PIECE(1, j + 2));
+
+		put_piece(pos, SQUARE(0, 7 - j), MAKE_PIECE(0, j + 2));
+		put_piece(pos, SQUARE(7, 7 - j), MAKE_PIECE(1, j + 2));
+		if (j == 3) {
+			put_piece(pos, SQUARE(0, j), MAKE_PIECE(0, PIECE_KING));
+			put_piece(pos, SQUARE(7, j), MAKE_PIECE(1, PIECE_KING));
+		}
+	}
+
+	pos->side = 0;
+	pos->castling = CASTLE_WHITE_KING | CASTLE_WHITE_QUEEN |
+	                CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN;
+	pos->ep_square = NO_SQUARE;
+	pos->halfmove = 0;
+
+	find_kings(pos);
+	pos->hash = position_hash(pos);
+	reset_score(pos);
+}
+
+/**
+ * Returns whether the game is over for the side to move. Stops at the first
+ * legal move it finds, trying the king first, then taking the checker, then
+ * blocking the check.
+ *
+ * Returns: GAME_ONGOING, GAME_CHECKMATE or GAME_STALEMATE
+ */
+int game_status(chess_position_t *pos) {
+	int side = pos->side;
+	int dir;
+	int square;
+	move_t moves[MAX_PIECE_MOVES];
+	struct legality legal;
+
+	compute_legality(pos, side, &legal);
+
+	// the king is the only piece that can answer every check
+	if (king_has_move(pos, legal.king, side)) return GAME_ONGOING;
+	if (legal.checkers > 1) return GAME_CHECKMATE;
+
+	if (legal.checkers) {
+		// take the checker
+		if (square_reachable(pos, legal.checker, side, &legal)) return GAME_ONGOING;
+
+		// a pawn that just pushed two can also be taken en passant
+		if (pos->ep_square != NO_SQUARE) {
+			for (dir = 6 - 2 * side; dir < 8 - 2 * side; dir++) {
+				if (!ray_length[pos->ep_square][dir]) continue;
+
+				square = pos->ep_square + direction_offset[dir];
+				if (PIECE_AT(pos, square) == MAKE_PIECE(side, PIECE_PAWN) &&
+				        en_passant_legal(pos, square, side)) return GAME_ONGOING;
+			}
+		}
+
+		// or step in between a sliding checker and the king
+		if (legal.check_dir >= 0) {
+			square = legal.king + direction_offset[legal.check_dir];
+			for (; square != legal.checker; square += direction_offset[legal.check_dir]) {
+				if (square_reachable(pos, square, side, &legal)) return GAME_ONGOING;
+			}
+		}
+		return GAME_CHECKMATE;
+	}
+
+	// go through every other piece the player has, two empty squares at a time
+	for (square = 0; square < 64; square++) {
+		if (!pos->board[square >> 1]) {
+			square |= 1;
+			continue;
+		}
+		if (square == legal.king) continue;
+		if (add_piece_moves(pos, square, side, &legal, moves) > 0) return GAME_ONGOING;
+	}
+
+	return GAME_STALEMATE;
+}
+
+/**
+ * Returns whether the game is drawn by the fifty move rule or by the
+ * position on the board having come up three times. Only positions with
+ * the same side to move are compared, and only as far back as the last
+ * capture or pawn move.
+ *
+ * Returns: GAME_ONGOING, GAME_REPETITION or GAME_FIFTY_MOVES
+ */
+int draw_status(const chess_history_t *history, const chess_position_t *pos) {
+	history_key_t key = HISTORY_KEY(pos->hash);
+	int repeats = 0;
+	int i;
+
+	if (pos->halfmove >= 100) return GAME_FIFTY_MOVES;
+
+	// the newest entry is this position, so start two plies before it
+	for (i = 2; i < history->count; i += 2) {
+		if (history->keys[(history->head - 1 - i) & (HISTORY_SIZE - 1)] == key &&
+		        ++repeats == 2) {
+			return GAME_REPETITION;
+		}
+	}
+	return GAME_ONGOING;
+}
+
+/**
+ * Starts the history over with the given position as its only entry.
+ */
+void reset_history(chess_history_t *history, const chess_position_t *pos) {
+	history->head = 0;
+	history->count = 0;
+	record_position(history, pos);
+}
+
+/**
+ * Adds the position to the history. Call it after every move played, with
+ * the position the move led to.
+ */
+void record_position(chess_history_t *history, const chess_position_t *pos) {
+	// nothing before a capture or pawn move can come up again
+	if (pos->halfmove == 0) history->count = 0;
+
+	history->keys[history->head] = HISTORY_KEY(pos->hash);
+	history->head = (history->head + 1) & (HISTORY_SIZE - 1);
+	if (history->count < HISTORY_SIZE) history->count++;
+}
+
+/**
+ * Returns whether the side to move is in check or not.
+ * Return 1 if in check, 0 if not, -1 if error
+ */
+int in_check(chess_position_t *pos) {
+	int side = pos->side;
+	int king = KING_SQUARE(pos, side);
+
+	// SHOULD NEVER HAPPEN
+	if (PIECE_AT(pos, king) != MAKE_PIECE(side, PIECE_KING)) return -1;
+
+	return square_attacked(pos, king, side);
+}
+
+/**
+ * Fills the move list with every legal move of the side to move. The board
+ * is left as it was, so there is nothing to revert afterwards.
+ *
+ * The list must have room for MAX_MOVES moves.
+ *
+ * Returns: num of legal moves
+ */
+int generate_legal_moves(chess_position_t *pos, move_t *moves) {
+	int side = pos->side;
+	int square;
+	int num_moves = 0;
+	struct legality legal;
+
+	compute_legality(pos, side, &legal);
+
+	// two empty squares share a zero byte, so they are passed over together
+	for (square = 0; square < 64; square++) {
+		if (!pos->board[square >> 1]) {
+			square |= 1;
+			continue;
+		}
+		num_moves += add_piece_moves(pos, square, side, &legal, moves + num_moves);
+	}
+	return num_moves;
+}
+
+/**
+ * Fills the move list with the legal moves of the piece at the given
+ * position. Promotions are listed queen first.
+ *
+ * The list must have room for MAX_PIECE_MOVES moves.
+ *
+ * Returns: num of legal moves, 0 if the square doesn't hold a piece of the
+ * side to move
+ */
+int generate_piece_moves(chess_position_t *pos, int x_pos, int y_pos,
+                         move_t *moves) {
+	struct legality legal;
+	int piece = PIECE_AT(pos, SQUARE(x_pos, y_pos));
+
+	if (piece == PIECE_EMPTY || PIECE_SIDE(piece) != pos->side) return 0;
+
+	compute_legality(pos, pos->side, &legal);
+	return add_piece_moves(pos, SQUARE(x_pos, y_pos), pos->side, &legal, moves);
+}
+
+/**
+ * Finds the legal move of the side to move that comes after the given one
+ * in the order generate_legal_moves() lists them, or the first one if move
+ * is 0, skipping moves outside the stage (MOVES_*). Nothing is kept between
+ * calls: where to go on from is worked out from the move itself, so a
+ * search can walk through the moves of a position without a list of them.
+ * Each move found costs an attack test of the king, which the list
+ * generators mostly get out of with the pin and check masks.
+ *
+ * Returns: the next legal move, or 0 if there are no more
+ */
+move_t next_legal_move(chess_position_t *pos, move_t move, int stage) {
+	int side = pos->side;
+	int square = move ? MOVE_FROM(move) : 0;
+	int piece;
+	int tactical;
+
+	for (; square < 64; square++) {
+		if (!pos->board[square >> 1]) {
+			square |= 1;
+			continue;
+		}
+		piece = PIECE_AT(pos, square);
+		if (piece == PIECE_EMPTY || PIECE_SIDE(piece) != side) continue;
+
+		// past the piece of the last move, start from the first move
+		if (move && MOVE_FROM(move) != square) move = 0;
+
+		while ((move = next_piece_move(pos, square, move,
+		                               stage == MOVES_CAPTURES)) != 0) {
+			tactical = MOVE_IS_CAPTURE(move) || MOVE_IS_PROMOTION(move);
+			if (stage == MOVES_CAPTURES && !tactical) continue;
+			if (stage == MOVES_QUIETS && tactical) continue;
+			if (king_safe_after(pos, move)) return move;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Checks a move that didn't come from a move list of this position, such
+ * as one remembered from another position, against the rules.
+ *
+ * Returns: 1 if the move is legal here, 0 if not
+ */
+int is_legal_move(chess_position_t *pos, move_t move) {
+	int from = MOVE_FROM(move);
+	int piece = PIECE_AT(pos, from);
+	move_t next = 0;
+
+	if (!move || piece == PIECE_EMPTY || PIECE_SIDE(piece) != pos->side) return 0;
+
+	while ((next = next_piece_move(pos, from, next, 0)) != 0) {
+		if (next == move) return king_safe_after(pos, move);
+	}
+	return 0;
+}
+
+/**
+ * Returns the piece id associated with the input position.
+ *
+ * Returns: piece id at location
+ */
+int get_piece_at_pos(const chess_position_t *pos, int x_pos, int y_pos) {
+	return PIECE_AT(pos, SQUARE(x_pos, y_pos));
+}
+
+/**
+ * Play a move from the legal move list on the board, including the rook hop
+ * of a castle, the pawn taken en passant, the promotion and the loss of
+ * castling rights, then hand the turn to the other side. The hash and the
+ * evaluation scores are updated piece by piece as the board changes. Unless
+ * undo is 0, what unmake_move() needs to take the move back goes in it.
+ */
+void make_move(chess_position_t *pos, move_t move, chess_undo_t *undo) {
+	int side = pos->side;
+	int from = MOVE_FROM(move);
+	int to = MOVE_TO(move);
+	int flags = MOVE_FLAGS(move);
+	int piece = PIECE_AT(pos, from);
+	int x_pos = SQUARE_X(from);
+	int their_pawn = MAKE_PIECE(1 - side, PIECE_PAWN);
+	int rook = MAKE_PIECE(side, PIECE_ROOK);
+	int taken;
+	zobrist_t hash = pos->hash ^ zobrist_side ^ zobrist_castling[pos->castling];
+
+	if (undo) {
+		undo->captured = (flags == MOVE_EN_PASSANT) ? their_pawn : PIECE_AT(pos, to);
+		undo->castling = pos->castling;
+		undo->ep_square = pos->ep_square;
+		undo->halfmove = pos->halfmove;
+	}
+
+	if (pos->ep_square != NO_SQUARE) {
+		hash ^= zobrist_en_passant[SQUARE_Y(pos->ep_square)];
+	}
+
+	// the clock restarts on any capture or pawn move
+	if ((flags & MOVE_CAPTURE) || PIECE_TYPE(piece) == PIECE_PAWN) {
+		pos->halfmove = 0;
+	} else if (pos->halfmove < 255) {
+		pos->halfmove++;
+	}
+
+	hash ^= ZOBRIST_PIECE(piece, from);
+	remove_piece_score(pos, piece, from);
+	if (flags & MOVE_PROMOTION) piece = MAKE_PIECE(side, MOVE_PROMOTION_PIECE(move));
+	hash ^= ZOBRIST_PIECE(piece, to);
+	add_piece_score(pos, piece, to);
+
+	if (flags == MOVE_EN_PASSANT) {
+		taken = to + (side ? 8 : -8);
+		hash ^= ZOBRIST_PIECE(their_pawn, taken);
+		remove_piece_score(pos, their_pawn, taken);
+		put_piece(pos, taken, 0);
+	} else if (flags & MOVE_CAPTURE) {
+		taken = PIECE_AT(pos, to);
+		hash ^= ZOBRIST_PIECE(taken, to);
+		remove_piece_score(pos, taken, to);
+	}
+
+	put_piece(pos, to, piece);
+	put_piece(pos, from, 0);
+
+	if (flags == MOVE_KING_CASTLE) {
+		put_piece(pos, SQUARE(x_pos, 0), 0);
+		put_piece(pos, SQUARE(x_pos, 2), rook);
+		hash ^= ZOBRIST_PIECE(rook, SQUARE(x_pos, 0)) ^ ZOBRIST_PIECE(rook, SQUARE(x_pos, 2));
+		remove_piece_score(pos, rook, SQUARE(x_pos, 0));
+		add_piece_score(pos, rook, SQUARE(x_pos, 2));
+	} else if (flags == MOVE_QUEEN_CASTLE) {
+		put_piece(pos, SQUARE(x_pos, 7), 0);
+		put_piece(pos, SQUARE(x_pos, 4), rook);
+		hash ^= ZOBRIST_PIECE(rook, SQUARE(x_pos, 7)) ^ ZOBRIST_PIECE(rook, SQUARE(x_pos, 4));
+		remove_piece_score(pos, rook, SQUARE(x_pos, 7));
+		add_piece_score(pos, rook, SQUARE(x_pos, 4));
+	}
+
+	// only leave an en passant square when a pawn is there to use it
+	pos->ep_square = NO_SQUARE;
+	if (flags == MOVE_DOUBLE_PUSH &&
+	        ((SQUARE_Y(to) > 0 && PIECE_AT(pos, to - 1) == their_pawn) ||
+	         (SQUARE_Y(to) < 7 && PIECE_AT(pos, to + 1) == their_pawn))) {
+		pos->ep_square = (from + to) >> 1;
+		hash ^= zobrist_en_passant[SQUARE_Y(pos->ep_square)];
+	}
+
+	if (PIECE_TYPE(piece) == PIECE_KING) {
+		pos->king[side] = to;
+		pos->castling &= side ? ~(CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN)
+		                      : ~(CASTLE_WHITE_KING | CASTLE_WHITE_QUEEN);
+	}
+
+	// a rook leaving or being taken on its starting square loses the castle
+	clear_castle_rights(pos, from);
+	clear_castle_rights(pos, to);
+
+	pos->side = 1 - side;
+	pos->hash = hash ^ zobrist_castling[pos->castling];
+
+#ifdef CHESS_DEBUG
+	assert(pos->hash == position_hash(pos));
+	{
+		chess_position_t check = *pos;
+
+		reset_score(&check);
+		assert(check.midgame == pos->midgame && check.endgame == pos->endgame &&
+		       check.phase == pos->phase);
+	}
+#endif
+}
+
+/**
+ * Take back the move make_move() played last, with the undo it filled in,
+ * and hand the turn back. The hash and the evaluation scores are put back
+ * piece by piece, the same way make_move() changed them, so a search can
+ * try its moves out on a single position instead of on copies.
+ */
+void unmake_move(chess_position_t *pos, move_t move, const chess_undo_t *undo) {
+	int side = 1 - pos->side;
+	int from = MOVE_FROM(move);
+	int to = MOVE_TO(move);
+	int flags = MOVE_FLAGS(move);
+	int piece = PIECE_AT(pos, to);
+	int x_pos = SQUARE_X(from);
+	int rook = MAKE_PIECE(side, PIECE_ROOK);
+	int taken;
+	zobrist_t hash = pos->hash ^ zobrist_side ^ zobrist_castling[pos->castling];
+
+	if (pos->ep_square != NO_SQUARE) {
+		hash ^= zobrist_en_passant[SQUARE_Y(pos->ep_square)];
+	}
+
+	if (flags == MOVE_KING_CASTLE) {
+		put_piece(pos, SQUARE(x_pos, 2), 0);
+		put_piece(pos, SQUARE(x_pos, 0), rook);
+		hash ^= ZOBRIST_PIECE(rook, SQUARE(x_pos, 2)) ^ ZOBRIST_PIECE(rook, SQUARE(x_pos, 0));
+		remove_piece_score(pos, rook, SQUARE(x_pos, 2));
+		add_piece_score(pos, rook, SQUARE(x_pos, 0));
+	} else if (flags == MOVE_QUEEN_CASTLE) {
+		put_piece(pos, SQUARE(x_pos, 4), 0);
+		put_piece(pos, SQUARE(x_pos, 7), rook);
+		hash ^= ZOBRIST_PIECE(rook, SQUARE(x_pos, 4)) ^ ZOBRIST_PIECE(rook, SQUARE(x_pos, 7));
+		remove_piece_score(pos, rook, SQUARE(x_pos, 4));
+		add_piece_score(pos, rook, SQUARE(x_pos, 7));
+	}
+
+	hash ^= ZOBRIST_PIECE(piece, to);
+	remove_piece_score(pos, piece, to);
+	if (flags & MOVE_PROMOTION) piece = MAKE_PIECE(side, PIECE_PAWN);
+	hash ^= ZOBRIST_PIECE(piece, from);
+	add_piece_score(pos, piece, from);
+
+	put_piece(pos, from, piece);
+	put_piece(pos, to, 0);
+
+	if (flags == MOVE_EN_PASSANT) {
+		taken = to + (side ? 8 : -8);
+		put_piece(pos, taken, undo->captured);
+		hash ^= ZOBRIST_PIECE(undo->captured, taken);
+		add_piece_score(pos, undo->captured, taken);
+	} else if (flags & MOVE_CAPTURE) {
+		put_piece(pos, to, undo->captured);
+		hash ^= ZOBRIST_PIECE(undo->captured, to);
+		add_piece_score(pos, undo->captured, to);
+	}
+
+	if (PIECE_TYPE(piece) == PIECE_KING) pos->king[side] = from;
+
+	pos->castling = undo->castling;
+	pos->ep_square = undo->ep_square;
+	pos->halfmove = undo->halfmove;
+	if (pos->ep_square != NO_SQUARE) {
+		hash ^= zobrist_en_passant[SQUARE_Y(pos->ep_square)];
+	}
+
+	pos->side = side;
+	pos->hash = hash ^ zobrist_castling[pos->castling];
+
+#ifdef CHESS_DEBUG
+	assert(pos->hash == position_hash(pos));
+	{
+		chess_position_t check = *pos;
+
+		reset_score(&check);
+		assert(check.midgame == pos->midgame && check.endgame == pos->endgame &&
+		       check.phase == pos->phase);
+	}
+#endif
+}
+
+/**
+ * Works out the Zobrist hash of the position from scratch. Only needed when
+ * a position is set up by hand; make_move() keeps pos->hash current.
+ *
+ * Returns: hash of the position
+ */
+zobrist_t position_hash(const chess_position_t *pos) {
+	zobrist_t hash = zobrist_castling[pos->castling];
+	int square;
+	int piece;
+
+	for (square = 0; square < 64; square++) {
+		piece = PIECE_AT(pos, square);
+		if (piece != PIECE_EMPTY) hash ^= ZOBRIST_PIECE(piece, square);
+	}
+
+	if (pos->ep_square != NO_SQUARE) {
+		hash ^= zobrist_en_passant[SQUARE_Y(pos->ep_square)];
+	}
+	if (pos->side) hash ^= zobrist_side;
+
+	return hash;
+}
+
+/**
+ * Request that the piece given by parameter at the original location be moved to the new location.
+ * Pawns reaching the last rank are promoted to a queen.
+ *
+ * Returns: 1 if the move was successful, 0 if not
+ */
+int send_move(chess_position_t *pos, int orig_x_pos, int orig_y_pos,
+              int new_x_pos, int new_y_pos) {
+	move_t moves[MAX_PIECE_MOVES];
+	int num_moves = generate_piece_moves(pos, orig_x_pos, orig_y_pos, moves);
+	int to = SQUARE(new_x_pos, new_y_pos);
+	int i;
+
+	// promotions are generated queen first, so the first match is the one we want
+	for (i = 0; i < num_moves; i++) {
+		if (MOVE_TO(moves[i]) == to) {
+			make_move(pos, moves[i], 0);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+/**
+ *
+ * BELOW IS LIST OF INTERNAL FUNCTIONS, THERE SHOULD BE NO NEED TO CALL THESE
+ *
+ */
+/////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+/**
+ *
+ * Calculates whether the square is attacked by the enemy of side from diagonal.
+ * Returns: 1 if in check, 0 if not
+ */
+int checkDiagonal(chess_position_t *pos, int square, int side) {
+	int i;
+
+	// their pawns one step towards their own side of the board
+	for (i = 4 + 2 * side; i < 6 + 2 * side; i++) {
+		if (ray_length[square][i] && PIECE_AT(pos, square + direction_offset[i]) ==
+		        MAKE_PIECE(1 - side, PIECE_PAWN)) {
+			return 1;
+		}
+	}
+
+	return check_rays(pos, square, side, 4, 8, PIECE_BISHOP);
+}
+
+/**
+ * Calculates whether the square is attacked by the enemy of side from rows.
+ * Returns: 1 if in check, 0 if not
+ */
+int checkRows(chess_position_t *pos, int square, int side) {
+	return check_rays(pos, square, side, 0, 2, PIECE_ROOK);
+}
+
+/**
+ * Calculates whether the square is attacked by the enemy of side from columns.
+ * Returns: 1 if in check, 0 if not
+ */
+int checkColumns(chess_position_t *pos, int square, int side) {
+	return check_rays(pos, square, side, 2, 4, PIECE_ROOK);
+}
+
+/**
+ * Calculates whether the square is attacked by the enemy of side from knight.
+ * Returns: 1 if in check, 0 if not
+ */
+int checkKnight(chess_position_t *pos, int square, int side) {
+	const unsigned char *target;
+
+	for (target = knight_targets[square]; *target != NO_SQUARE; target++) {
+		if (PIECE_AT(pos, *target) == MAKE_PIECE(1 - side, PIECE_KNIGHT)) return 1;
+	}
+	return 0;
+}
+
+/**
+ * Calculates whether the square is attacked by the enemy king.
+ * Returns: 1 if in check, 0 if not
+ */
+int checkKing(chess_position_t *pos, int square, int side) {
+	const unsigned char *target;
+
+	for (target = king_targets[square]; *target != NO_SQUARE; target++) {
+		if (PIECE_AT(pos, *target) == MAKE_PIECE(1 - side, PIECE_KING)) return 1;
+	}
+	return 0;
+}
+
+/**
+ * Walks the rays of the given directions out from the square and checks
+ * whether the first piece on any of them is an enemy queen or slider.
+ * Returns: 1 if in check, 0 if not
+ */
+static int check_rays(chess_position_t *pos, int square, int side,
+                      int first_dir, int last_dir, int slider) {
+	int enemy_slider = MAKE_PIECE(1 - side, slider);
+	int enemy_queen = MAKE_PIECE(1 - side, PIECE_QUEEN);
+	int new_square;
+	int refval;
+	int i;
+	int j;
+
+	for (i = first_dir; i < last_dir; i++) { // outer loop over the rays
+		new_square = square;
+
+		for (j = ray_length[square][i]; j > 0; j--) { // inner loop to the edge
+			new_square += direction_offset[i];
+			refval = PIECE_AT(pos, new_square);
+
+			// if empty space, continue
+			if (refval == 0) continue;
+
+			// only option left to check is an enemy slider or queen
+			if (refval == enemy_slider || refval == enemy_queen) return 1;
+			break;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Calculates whether the square is attacked by any piece of the enemy of
+ * side. The square itself doesn't need to hold a piece.
+ * Returns: 1 if attacked, 0 if not
+ */
+static int square_attacked(chess_position_t *pos, int square, int side) {
+	return checkDiagonal(pos, square, side) || checkRows(pos, square, side) ||
+	       checkColumns(pos, square, side) || checkKnight(pos, square, side) ||
+	       checkKing(pos, square, side);
+}
+
+/**
+ * Walks out from the side's king once to find every checker and every pinned
+ * piece, and fills in the masks the move generators filter with.
+ */
+static void compute_legality(chess_position_t *pos, int side,
+                             struct legality *legal) {
+	int enemy = 1 - side;
+	int king = KING_SQUARE(pos, side);
+	const unsigned char *target;
+	int new_square;
+	int blocker;
+	int refval;
+	int i;
+	int j;
+	unsigned long long ray;
+
+	legal->king = king;
+	legal->checkers = 0;
+	legal->checker = -1;
+	legal->check_dir = -1;
+	legal->check_mask = 0;
+	legal->pinned = 0;
+
+	// sliding pieces, both checks and pins
+	for (i = 0; i < 8; i++) {
+		new_square = king;
+		blocker = -1;
+		ray = 0;
+
+		for (j = ray_length[king][i]; j > 0; j--) {
+			new_square += direction_offset[i];
+			ray |= SQUARE_BIT(new_square);
+			refval = PIECE_AT(pos, new_square);
+
+			// if empty space, continue
+			if (refval == 0) continue;
+
+			// the first of our pieces may be pinned, a second one shields the king
+			if (PIECE_SIDE(refval) == side) {
+				if (blocker >= 0) break;
+				blocker = new_square;
+				continue;
+			}
+
+			// their piece only matters if it slides along this direction
+			if (refval == MAKE_PIECE(enemy, PIECE_QUEEN) ||
+			        refval == MAKE_PIECE(enemy, i < 4 ? PIECE_ROOK : PIECE_BISHOP)) {
+				if (blocker < 0) {
+					legal->checkers++;
+					legal->checker = new_square;
+					legal->check_dir = i;
+					legal->check_mask |= ray;
+				} else {
+					legal->pinned |= SQUARE_BIT(blocker);
+				}
+			}
+			break;
+		}
+	}
+
+	// knights
+	for (target = knight_targets[king]; *target != NO_SQUARE; target++) {
+		if (PIECE_AT(pos, *target) == MAKE_PIECE(enemy, PIECE_KNIGHT)) {
+			legal->checkers++;
+			legal->checker = *target;
+			legal->check_dir = -1;
+			legal->check_mask |= SQUARE_BIT(*target);
+		}
+	}
+
+	// pawns
+	for (i = 4 + 2 * side; i < 6 + 2 * side; i++) {
+		if (ray_length[king][i] &&
+		        PIECE_AT(pos, king + direction_offset[i]) == MAKE_PIECE(enemy, PIECE_PAWN)) {
+			legal->checkers++;
+			legal->checker = king + direction_offset[i];
+			legal->check_dir = -1;
+			legal->check_mask |= SQUARE_BIT(king + direction_offset[i]);
+		}
+	}
+
+	// out of check anything goes, in double check only the king may move
+	if (legal->checkers == 0) legal->check_mask = ALL_SQUARES;
+	else if (legal->checkers > 1) legal->check_mask = 0;
+}
+
+/**
+ * Calculate the legal moves of the side's piece on the given square.
+ *
+ * Returns: number of moves
+ */
+static int add_piece_moves(chess_position_t *pos, int square, int side,
+                           const struct legality *legal, move_t *moves) {
+	int piece = PIECE_AT(pos, square);
+	unsigned long long target_mask;
+	int num_moves;
+
+	if (piece == PIECE_EMPTY || PIECE_SIDE(piece) != side) return 0;
+
+	if (PIECE_TYPE(piece) == PIECE_KING) {
+		num_moves = add_king_moves(pos, square, side, ALL_SQUARES, moves);
+		if (square == SQUARE(7 * side, 3)) {
+			num_moves += add_castling_moves(pos, side, legal, moves + num_moves);
+		}
+		return num_moves;
+	}
+
+	target_mask = legal->check_mask;
+
+	// a pinned piece may only move along the pin
+	if (legal->pinned & SQUARE_BIT(square)) {
+		target_mask &= pin_ray(pos, legal->king, square, side);
+	}
+
+	if (!target_mask) return 0;
+
+	switch (PIECE_TYPE(piece)) {
+		case PIECE_PAWN:
+			return add_pawn_moves(pos, square, side, target_mask, moves);
+		case PIECE_ROOK:
+			return add_step_moves(pos, square, side, 0, 4, target_mask, moves);
+		case PIECE_KNIGHT:
+			return add_knight_moves(pos, square, side, target_mask, moves);
+		case PIECE_BISHOP:
+			return add_step_moves(pos, square, side, 4, 8, target_mask, moves);
+		case PIECE_QUEEN:
+			return add_step_moves(pos, square, side, 0, 8, target_mask, moves);
+	}
+	return 0;
+}
+
+/**
+ * Appends the move to the list if it lands on the target mask. Pawn moves to
+ * the last rank are expanded into the four promotions, queen first.
+ *
+ * Returns: new num of moves in the list
+ */
+static int add_move(move_t *moves, int num_moves, int from, int to,
+                    int flags, unsigned long long target_mask) {
+	int promotion;
+
+	if (!(target_mask & SQUARE_BIT(to))) return num_moves;
+
+	if (flags & MOVE_PROMOTION) {
+		for (promotion = 3; promotion >= 0; promotion--) {
+			moves[num_moves++] = MAKE_MOVE(from, to, flags | promotion);
+		}
+	} else {
+		moves[num_moves++] = MAKE_MOVE(from, to, flags);
+	}
+	return num_moves;
+}
+
+/**
+ * Calculate the pushes and captures of a pawn. A pawn is never on its last
+ * rank, so the square ahead of it always exists.
+ *
+ * Returns: number of moves
+ */
+static int add_pawn_moves(chess_position_t *pos, int square, int side,
+                          unsigned long long target_mask, move_t *moves) {
+	int forward = side ? -8 : 8;
+	int adv_pawn = square + forward;
+	int promotion = (SQUARE_X(adv_pawn) == 7 * (1 - side)) ? MOVE_PROMOTION : 0;
+	int num_moves = 0;
+	int target;
+	int i;
+
+	// pawn moves up single space, or two if it hasn't been moved yet
+	if (PIECE_AT(pos, adv_pawn) == 0) {
+		num_moves = add_move(moves, num_moves, square, adv_pawn,
+		                     MOVE_QUIET | promotion, target_mask);
+
+		if (SQUARE_X(square) == 1 + 5 * side && PIECE_AT(pos, adv_pawn + forward) == 0) {
+			num_moves = add_move(moves, num_moves, square, adv_pawn + forward,
+			                     MOVE_DOUBLE_PUSH, target_mask);
+		}
+	}
+
+	// pawn takes to either side
+	for (i = 4 + 2 * side; i < 6 + 2 * side; i++) {
+		if (!ray_length[square][i]) continue;
+
+		target = PIECE_AT(pos, square + direction_offset[i]);
+		if (target != 0 && PIECE_SIDE(target) != side) {
+			num_moves = add_move(moves, num_moves, square,
+			                     square + direction_offset[i],
+			                     MOVE_CAPTURE | promotion, target_mask);
+		} else if (square + direction_offset[i] == pos->ep_square &&
+		           en_passant_legal(pos, square, side)) {
+			// takes two pawns off one rank, so the masks can't vouch for it
+			moves[num_moves++] = MAKE_MOVE(square, pos->ep_square, MOVE_EN_PASSANT);
+		}
+	}
+	return num_moves;
+}
+
+/**
+ * Calculate the possible moves of a piece sliding along the given range of
+ * directions.
+ *
+ * Returns: number of moves
+ */
+static int add_step_moves(chess_position_t *pos, int square, int side,
+                          int first_dir, int last_dir,
+                          unsigned long long target_mask, move_t *moves) {
+	int num_moves = 0;
+	int new_square;
+	int target;
+	int i;
+	int j;
+
+	for (i = first_dir; i < last_dir; i++) {
+		new_square = square;
+
+		for (j = ray_length[square][i]; j > 0; j--) {
+			new_square += direction_offset[i];
+			target = PIECE_AT(pos, new_square);
+
+			// if empty space, verify and continue
+			if (target == 0) {
+				num_moves = add_move(moves, num_moves, square, new_square,
+				                     MOVE_QUIET, target_mask);
+				continue;
+			}
+
+			// if their piece is in the way, verify the take
+			if (PIECE_SIDE(target) != side) {
+				num_moves = add_move(moves, num_moves, square, new_square,
+				                     MOVE_CAPTURE, target_mask);
+			}
+			break;
+		}
+	}
+	return num_moves;
+}
+
+/**
+ * Calculate the possible moves of a knight.
+ *
+ * Returns: number of moves
+ */
+static int add_knight_moves(chess_position_t *pos, int square, int side,
+                            unsigned long long target_mask, move_t *moves) {
+	const unsigned char *new_square;
+	int num_moves = 0;
+	int target;
+
+	for (new_square = knight_targets[square]; *new_square != NO_SQUARE;
+	        new_square++) {
+		target = PIECE_AT(pos, *new_square);
+		if (target == 0) {
+			num_moves = add_move(moves, num_moves, square, *new_square,
+			                     MOVE_QUIET, target_mask);
+		} else if (PIECE_SIDE(target) != side) {
+			num_moves = add_move(moves, num_moves, square, *new_square,
+			                     MOVE_CAPTURE, target_mask);
+		}
+	}
+	return num_moves;
+}
+
+/**
+ * Calculate the single step moves of the king onto the target mask. These
+ * are the only moves that need an attack test, which is done with the king
+ * lifted off the board so it can't hide behind itself from a slider.
+ *
+ * Returns: number of moves
+ */
+static int add_king_moves(chess_position_t *pos, int square, int side,
+                          unsigned long long target_mask, move_t *moves) {
+	const unsigned char *new_square;
+	int king = PIECE_AT(pos, square);
+	int num_moves = 0;
+	int target;
+
+	put_piece(pos, square, 0);
+
+	for (new_square = king_targets[square]; *new_square != NO_SQUARE;
+	        new_square++) {
+		target = PIECE_AT(pos, *new_square);
+		if (target != 0 && PIECE_SIDE(target) == side) continue;
+		if (!(target_mask & SQUARE_BIT(*new_square))) continue;
+		if (square_attacked(pos, *new_square, side)) continue;
+
+		moves[num_moves++] = MAKE_MOVE(square, *new_square,
+		                               target ? MOVE_CAPTURE : MOVE_QUIET);
+	}
+
+	put_piece(pos, square, king);
+	return num_moves;
+}
+
+/**
+ * Calculate the castling moves of a king on its starting square. The king
+ * may not castle out of, through or into check.
+ *
+ * Returns: number of moves
+ */
+static int add_castling_moves(chess_position_t *pos, int side,
+                              const struct legality *legal, move_t *moves) {
+	int x_pos = 7 * side;
+	int king = SQUARE(x_pos, 3);
+	int num_moves = 0;
+
+	if (legal->checkers) return 0;
+
+	if (castle_allowed(pos, side, 0)) {
+		moves[num_moves++] = MAKE_MOVE(king, SQUARE(x_pos, 1),
+		                               MOVE_KING_CASTLE);
+	}
+	if (castle_allowed(pos, side, 1)) {
+		moves[num_moves++] = MAKE_MOVE(king, SQUARE(x_pos, 5),
+		                               MOVE_QUEEN_CASTLE);
+	}
+	return num_moves;
+}
+
+/**
+ * Checks one castle of a king on its starting square, short of whether the
+ * king is in check: the right is still there, the rook is home, the squares
+ * between are empty and the king doesn't pass through or land on an attack.
+ *
+ * Returns: 1 if the castle is allowed, 0 if not
+ */
+static int castle_allowed(chess_position_t *pos, int side, int queen_side) {
+	int x_pos = 7 * side;
+	int rook = MAKE_PIECE(side, PIECE_ROOK);
+
+	if (queen_side) {
+		return (pos->castling & (side ? CASTLE_BLACK_QUEEN : CASTLE_WHITE_QUEEN)) &&
+		       PIECE_AT(pos, SQUARE(x_pos, 7)) == rook &&
+		       PIECE_AT(pos, SQUARE(x_pos, 4)) == 0 && PIECE_AT(pos, SQUARE(x_pos, 5)) == 0 &&
+		       PIECE_AT(pos, SQUARE(x_pos, 6)) == 0 &&
+		       !square_attacked(pos, SQUARE(x_pos, 4), side) &&
+		       !square_attacked(pos, SQUARE(x_pos, 5), side);
+	}
+	return (pos->castling & (side ? CASTLE_BLACK_KING : CASTLE_WHITE_KING)) &&
+	       PIECE_AT(pos, SQUARE(x_pos, 0)) == rook &&
+	       PIECE_AT(pos, SQUARE(x_pos, 1)) == 0 && PIECE_AT(pos, SQUARE(x_pos, 2)) == 0 &&
+	       !square_attacked(pos, SQUARE(x_pos, 2), side) &&
+	       !square_attacked(pos, SQUARE(x_pos, 1), side);
+}
+
+/**
+ * Finds the move of the piece on the square that comes after the given one
+ * in the order add_piece_moves() lists them, or the first one if move is 0.
+ * Unless captures is 0, only captures and promotions come out. Checks and
+ * pins are left to king_safe_after().
+ *
+ * Returns: the next move, or 0 if the piece has no more
+ */
+static move_t next_piece_move(chess_position_t *pos, int square, move_t move,
+                              int captures) {
+	int piece = PIECE_AT(pos, square);
+	int side = PIECE_SIDE(piece);
+
+	switch (PIECE_TYPE(piece)) {
+		case PIECE_PAWN:
+			return next_pawn_move(pos, square, side, move, captures);
+		case PIECE_ROOK:
+			return next_step_move(pos, square, side, 0, 4, move, captures);
+		case PIECE_KNIGHT:
+			return next_target_move(pos, square, side, knight_targets[square],
+			                        move, captures);
+		case PIECE_BISHOP:
+			return next_step_move(pos, square, side, 4, 8, move, captures);
+		case PIECE_QUEEN:
+			return next_step_move(pos, square, side, 0, 8, move, captures);
+		case PIECE_KING:
+			return next_king_move(pos, square, side, move, captures);
+	}
+	return 0;
+}
+
+/**
+ * next_piece_move() for a pawn: the push, the double push, then the takes
+ * to either side, with promotions queen first like add_move().
+ *
+ * Returns: the next move, or 0 if the pawn has no more
+ */
+static move_t next_pawn_move(chess_position_t *pos, int square, int side,
+                             move_t move, int captures) {
+	int forward = side ? -8 : 8;
+	int adv_pawn = square + forward;
+	int promotion = (SQUARE_X(adv_pawn) == 7 * (1 - side)) ? MOVE_PROMOTION | 3 : 0;
+	int step = 0;  // 0 push, 1 double push, 2 and 3 the takes
+	int target;
+	int to;
+	int i;
+
+	if (move) {
+		to = MOVE_TO(move);
+
+		// the other promotions onto the same square come first
+		if (MOVE_IS_PROMOTION(move) && (MOVE_FLAGS(move) & 0x03)) {
+			return MAKE_MOVE(square, to, MOVE_FLAGS(move) - 1);
+		}
+		if (to == adv_pawn) step = 1;
+		else if (MOVE_FLAGS(move) == MOVE_DOUBLE_PUSH) step = 2;
+		else step = (to == square + direction_offset[4 + 2 * side]) ? 3 : 4;
+	}
+
+	// pawn moves up single space, or two if it hasn't been moved yet
+	if (step == 0 && PIECE_AT(pos, adv_pawn) == 0 && (promotion || !captures)) {
+		return MAKE_MOVE(square, adv_pawn, MOVE_QUIET | promotion);
+	}
+	if (step <= 1 && !captures && SQUARE_X(square) == 1 + 5 * side &&
+	        PIECE_AT(pos, adv_pawn) == 0 && PIECE_AT(pos, adv_pawn + forward) == 0) {
+		return MAKE_MOVE(square, adv_pawn + forward, MOVE_DOUBLE_PUSH);
+	}
+
+	// pawn takes to either side
+	for (i = (step > 2 ? step : 2); i < 4; i++) {
+		if (!ray_length[square][2 + 2 * side + i]) continue;
+
+		to = square + direction_offset[2 + 2 * side + i];
+		target = PIECE_AT(pos, to);
+		if (target != 0 && PIECE_SIDE(target) != side) {
+			return MAKE_MOVE(square, to, MOVE_CAPTURE | promotion);
+		}
+		if (to == pos->ep_square) return MAKE_MOVE(square, to, MOVE_EN_PASSANT);
+	}
+	return 0;
+}
+
+/**
+ * next_piece_move() for a piece sliding along the given range of
+ * directions. A ray is followed on past a quiet move and left after a take.
+ *
+ * Returns: the next move, or 0 if the piece has no more
+ */
+static move_t next_step_move(chess_position_t *pos, int square, int side,
+                             int first_dir, int last_dir, move_t move,
+                             int captures) {
+	int new_square = square;
+	int dir = first_dir;
+	int target;
+
+	if (move) {
+		dir = ray_direction(square, MOVE_TO(move));
+		new_square = MOVE_TO(move);
+		if (MOVE_IS_CAPTURE(move)) {
+			dir++;
+			new_square = square;
+		}
+	}
+
+	for (; dir < last_dir; dir++, new_square = square) {
+		while (ray_length[new_square][dir]) {
+			new_square += direction_offset[dir];
+			target = PIECE_AT(pos, new_square);
+			if (target == 0) {
+				if (captures) continue;
+				return MAKE_MOVE(square, new_square, MOVE_QUIET);
+			}
+			if (PIECE_SIDE(target) != side) {
+				return MAKE_MOVE(square, new_square, MOVE_CAPTURE);
+			}
+			break;
+		}
+	}
+	return 0;
+}
+
+/**
+ * next_piece_move() for a piece with a fixed list of target squares, a
+ * knight or the steps of a king.
+ *
+ * Returns: the next move, or 0 if the piece has no more
+ */
+static move_t next_target_move(chess_position_t *pos, int square, int side,
+                               const unsigned char *target, move_t move,
+                               int captures) {
+	int refval;
+
+	if (move) {
+		while (*target++ != MOVE_TO(move));
+	}
+
+	for (; *target != NO_SQUARE; target++) {
+		refval = PIECE_AT(pos, *target);
+		if (refval == 0) {
+			if (!captures) return MAKE_MOVE(square, *target, MOVE_QUIET);
+		} else if (PIECE_SIDE(refval) != side) {
+			return MAKE_MOVE(square, *target, MOVE_CAPTURE);
+		}
+	}
+	return 0;
+}
+
+/**
+ * next_piece_move() for a king: its steps, then castling king side and
+ * queen side.
+ *
+ * Returns: the next move, or 0 if the king has no more
+ */
+static move_t next_king_move(chess_position_t *pos, int square, int side,
+                             move_t move, int captures) {
+	int flags = move ? MOVE_FLAGS(move) : MOVE_QUIET;
+	int castled = flags == MOVE_KING_CASTLE || flags == MOVE_QUEEN_CASTLE;
+	move_t next;
+
+	if (!castled) {
+		next = next_target_move(pos, square, side, king_targets[square], move,
+		                        captures);
+		if (next) return next;
+	}
+
+	if (captures || square != SQUARE(7 * side, 3) || flags == MOVE_QUEEN_CASTLE) {
+		return 0;
+	}
+
+	// the king may not castle out of check either
+	if (!castled && castle_allowed(pos, side, 0) && !square_attacked(pos, square, side)) {
+		return MAKE_MOVE(square, SQUARE(7 * side, 1), MOVE_KING_CASTLE);
+	}
+	if (castle_allowed(pos, side, 1) && !square_attacked(pos, square, side)) {
+		return MAKE_MOVE(square, SQUARE(7 * side, 5), MOVE_QUEEN_CASTLE);
+	}
+	return 0;
+}
+
+/**
+ * Tries the move on the board, without the bookkeeping of make_move(), and
+ * sees whether it leaves the mover's king attacked. Castling is checked
+ * square by square before it is offered, so it always passes.
+ *
+ * Returns: 1 if the move is legal, 0 if not
+ */
+static int king_safe_after(chess_position_t *pos, move_t move) {
+	int side = pos->side;
+	int from = MOVE_FROM(move);
+	int to = MOVE_TO(move);
+	int piece = PIECE_AT(pos, from);
+	int target = PIECE_AT(pos, to);
+	int king = KING_SQUARE(pos, side);
+	int safe;
+
+	if (MOVE_FLAGS(move) == MOVE_EN_PASSANT) return en_passant_legal(pos, from, side);
+	if (MOVE_FLAGS(move) == MOVE_KING_CASTLE || MOVE_FLAGS(move) == MOVE_QUEEN_CASTLE) {
+		return 1;
+	}
+
+	put_piece(pos, from, 0);
+	put_piece(pos, to, piece);
+	safe = !square_attacked(pos, from == king ? to : king, side);
+	put_piece(pos, to, target);
+	put_piece(pos, from, piece);
+	return safe;
+}
+
+/**
+ * Early exit version of add_king_moves(pos), for when it only matters whether
+ * the king can move at all.
+ *
+ * Returns: 1 if the king has a legal step, 0 if not
+ */
+static int king_has_move(chess_position_t *pos, int square, int side) {
+	const unsigned char *new_square;
+	int king = PIECE_AT(pos, square);
+	int found = 0;
+	int target;
+
+	put_piece(pos, square, 0);
+
+	for (new_square = king_targets[square]; *new_square != NO_SQUARE;
+	        new_square++) {
+		target = PIECE_AT(pos, *new_square);
+		if (target != 0 && PIECE_SIDE(target) == side) continue;
+		if (!square_attacked(pos, *new_square, side)) {
+			found = 1;
+			break;
+		}
+	}
+
+	put_piece(pos, square, king);
+	return found;
+}
+
+/**
+ * Works out whether a piece of side other than the king can legally move to
+ * the square, taking what is there or stepping onto it if it is empty. Only
+ * meant for answering a single check: a pinned piece can never do that, so
+ * pinned pieces are skipped and no other legality test is needed.
+ *
+ * Returns: 1 if some piece can get there, 0 if not
+ */
+static int square_reachable(chess_position_t *pos, int square, int side,
+                            const struct legality *legal) {
+	const unsigned char *target;
+	int back = side ? 8 : -8;
+	int new_square;
+	int refval;
+	int i;
+	int j;
+
+	// knights
+	for (target = knight_targets[square]; *target != NO_SQUARE; target++) {
+		if (PIECE_AT(pos, *target) == MAKE_PIECE(side, PIECE_KNIGHT) &&
+		        !(legal->pinned & SQUARE_BIT(*target))) return 1;
+	}
+
+	// sliders, the first piece along each ray
+	for (i = 0; i < 8; i++) {
+		new_square = square;
+
+		for (j = ray_length[square][i]; j > 0; j--) {
+			new_square += direction_offset[i];
+			refval = PIECE_AT(pos, new_square);
+
+			// if empty space, continue
+			if (refval == 0) continue;
+
+			if ((refval == MAKE_PIECE(side, PIECE_QUEEN) ||
+			        refval == MAKE_PIECE(side, i < 4 ? PIECE_ROOK : PIECE_BISHOP)) &&
+			        !(legal->pinned & SQUARE_BIT(new_square))) return 1;
+			break;
+		}
+	}
+
+	// pawns, which take diagonally but otherwise only push
+	if (PIECE_AT(pos, square) != 0) {
+		for (i = 6 - 2 * side; i < 8 - 2 * side; i++) {
+			if (ray_length[square][i] &&
+			        PIECE_AT(pos, square + direction_offset[i]) == MAKE_PIECE(side, PIECE_PAWN) &&
+			        !(legal->pinned & SQUARE_BIT(square + direction_offset[i]))) return 1;
+		}
+	} else if (SQUARE_X(square) != 7 * side) {
+		new_square = square + back;
+		if (PIECE_AT(pos, new_square) == MAKE_PIECE(side, PIECE_PAWN)) {
+			return !(legal->pinned & SQUARE_BIT(new_square));
+		}
+		if (PIECE_AT(pos, new_square) == 0 && SQUARE_X(square) == 3 + side &&
+		        PIECE_AT(pos, new_square + back) == MAKE_PIECE(side, PIECE_PAWN)) {
+			return !(legal->pinned & SQUARE_BIT(new_square + back));
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Tries the en passant capture of the pawn on the given square on the board
+ * and sees whether it leaves the king attacked. Both pawns leave the same
+ * rank at once, which neither the check mask nor the pin rays account for.
+ *
+ * Returns: 1 if the capture is legal, 0 if not
+ */
+static int en_passant_legal(chess_position_t *pos, int from, int side) {
+	int to = pos->ep_square;
+	int taken = to + (side ? 8 : -8);
+	int pawn = PIECE_AT(pos, from);
+	int legal;
+
+	put_piece(pos, from, 0);
+	put_piece(pos, taken, 0);
+	put_piece(pos, to, pawn);
+
+	legal = !square_attacked(pos, KING_SQUARE(pos, side), side);
+
+	put_piece(pos, to, 0);
+	put_piece(pos, taken, MAKE_PIECE(1 - side, PIECE_PAWN));
+	put_piece(pos, from, pawn);
+	return legal;
+}
+
+/**
+ * Works out the line a pinned piece is held on: the squares from the king
+ * out to and including the pinner. Pins are rare, so this is walked again
+ * when needed instead of keeping eight rays around for every position.
+ *
+ * Returns: mask of the squares the pinned piece may move to
+ */
+static unsigned long long pin_ray(chess_position_t *pos, int king, int square,
+                                  int side) {
+	int dir = ray_direction(king, square);
+	unsigned long long ray = 0;
+	int new_square = king;
+	int refval;
+	int j;
+
+	for (j = ray_length[king][dir]; j > 0; j--) {
+		new_square += direction_offset[dir];
+		ray |= SQUARE_BIT(new_square);
+
+		refval = PIECE_AT(pos, new_square);
+		if (refval != 0 && PIECE_SIDE(refval) != side) break;
+	}
+	return ray;
+}
+
+/**
+ * Works out which of the eight directions leads from one square to another
+ * on the same line.
+ *
+ * Returns: direction index into direction_offset
+ */
+static int ray_direction(int from, int to) {
+	// direction index by the sign of the x and y steps from one to the other
+	static const signed char directions[3][3] = {
+		{ 7, 1, 6 },
+		{ 3, -1, 2 },
+		{ 5, 0, 4 }
+	};
+	int x_step = SQUARE_X(to) - SQUARE_X(from);
+	int y_step = SQUARE_Y(to) - SQUARE_Y(from);
+
+	return directions[(x_step > 0) - (x_step < 0) + 1]
+	                 [(y_step > 0) - (y_step < 0) + 1];
+}
+
+/**
+ * Stores the piece id in the nibble of the board holding the square.
+ */
+static void put_piece(chess_position_t *pos, int square, int piece) {
+	unsigned char *cell = &pos->board[square >> 1];
+
+	if (square & 1) *cell = (*cell & 0x0F) | (piece << 4);
+	else *cell = (*cell & 0xF0) | piece;
+}
+
+/**
+ * Clears the castling right tied to the rook starting on the given square.
+ */
+static void clear_castle_rights(chess_position_t *pos, int square) {
+	if (square == SQUARE(0, 0)) pos->castling &= ~CASTLE_WHITE_KING;
+	else if (square == SQUARE(0, 7)) pos->castling &= ~CASTLE_WHITE_QUEEN;
+	else if (square == SQUARE(7, 0)) pos->castling &= ~CASTLE_BLACK_KING;
+	else if (square == SQUARE(7, 7)) pos->castling &= ~CASTLE_BLACK_QUEEN;
+}
+
+/**
+ * Finds both kings with a full board sweep. Only used when the whole board
+ * is set up at once; make_move() keeps the king squares current after that.
+ */
+static void find_kings(chess_position_t *pos) {
+	int square;
+	int piece;
+
+	for (square = 0; square < 64; square++) {
+		piece = PIECE_AT(pos, square);
+		if (PIECE_TYPE(piece) == PIECE_KING) pos->king[PIECE_SIDE(piece)] = square;
+	}
+}
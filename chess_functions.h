@@ -1,64 +1,300 @@
-/*
- * Eduardo Berg <eb28@rice.edu>
- * Logan Lawrence <lcl5@rice.edu>
- * Nathaniel Morris <nam6@rice.edu>
- *
- * Generic chess game functions.
- */
-#ifndef CHESS_FUNCTIONS
-#define CHESS_FUNCTIONS
-
-/**
- * Reset the current board back to starting chess orientation.
- * MAKE SURE TO CALL THIS WHEN INITIALIZING BOARD
- */
-void reset_board();
-
-/**
- * THIS METHOD IS INEFFICIENT
- *
- * Takes in current player side, and returns whether the player is in checkmate or not.
- * Return 1 if in checkmate , 0 if not, -1 if error
- */
-int in_checkmate(int side);
-
-/**
- * Takes in current player side, and returns whether the player is in check or not.
- * Return 1 if in check, 0 if not, -1 if error
- */
-int in_check(int side);
-
-/**
- * Calculates the possible moves of a piece given the position pressed. It does this by altering the state
- * of the current board, where a 1XX value means a move square and 2XX value means a take square
- *
- * REMEMBER TO REVERT TO ORIGINAL UNCALCULATED BOARD USING revert_board() IF THE USER DOESNT CHOOSE TO
- * MOVE SAID PIECE (you dont need to do this if num moves is 0)
- *
- * Returns: num of possible moves
- */
-int calculate_moves(int x_pos, int y_pos, int side);
-
-/**
- * Revert board to pre-calculated move state.
- *
- * NOTE: make sure to call this after using calculate_moves(),
- * plus it's fine to call it more often than not because it wont actually modify that values of any pieces
- */
-void revert_board();
-
-/**
- * Returns the piece id associated with the input position.
- *
- * Returns: piece id at location
- */
-int get_piece_at_pos(int x_pos, int y_pos);
-
-/**
- * Request that the piece given by parameter at the original location be moved to the new location.
- *
- * Returns: 1 if the move was successful, 0 if not
- */
-int send_move(int orig_x_pos, int orig_y_pos, int new_x_pos, int new_ypos, int side); 
-
-#endif /* CHESS_FUNCTIONS */
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Generic chess game functions.
+ */
+#ifndef CHESS_FUNCTIONS
+#define CHESS_FUNCTIONS
+
+/*
+ * Piece ids as stored on the board. They fit in a nibble: the low three bits
+ * hold the piece type and bit 3 is set for black.
+ */
+#define PIECE_EMPTY  0
+#define PIECE_PAWN   1
+#define PIECE_ROOK   2
+#define PIECE_KNIGHT 3
+#define PIECE_BISHOP 4
+#define PIECE_QUEEN  5
+#define PIECE_KING   6
+
+#define MAKE_PIECE(side, type) (((side) << 3) | (type))
+#define PIECE_SIDE(piece) ((piece) >> 3)
+#define PIECE_TYPE(piece) ((piece) & 0x07)
+
+/*
+ * Squares are numbered x * 8 + y, matching the [x][y] layout of the board
+ * and the button/LED coordinates.
+ */
+#define SQUARE(x_pos, y_pos) (((x_pos) << 3) + (y_pos))
+#define SQUARE_X(square) ((square) >> 3)
+#define SQUARE_Y(square) ((square) & 0x07)
+
+/*
+ * Bit of each square in a 64-bit square mask. The MSP430 shifts one bit at
+ * a time, so 1ULL << square would loop up to 63 times over four words; the
+ * bits come from a table in flash instead (chess_tables.c).
+ */
+extern const unsigned long long square_bit[64];
+
+#define SQUARE_BIT(square) (square_bit[square])
+
+/*
+ * A move is packed into 16 bits: bits 0-5 hold the origin square, bits 6-11
+ * the destination square and bits 12-15 the move flags below.
+ */
+typedef unsigned short move_t;
+
+#define MOVE_QUIET        0x0
+#define MOVE_DOUBLE_PUSH  0x1
+#define MOVE_KING_CASTLE  0x2
+#define MOVE_QUEEN_CASTLE 0x3
+#define MOVE_CAPTURE      0x4
+#define MOVE_EN_PASSANT   0x5
+#define MOVE_PROMOTION    0x8 /* low two bits select rook/knight/bishop/queen */
+
+#define MAKE_MOVE(from, to, flags) \
+    ((move_t) ((from) | ((to) << 6) | ((flags) << 12)))
+#define MOVE_FROM(move) ((move) & 0x3F)
+#define MOVE_TO(move) (((move) >> 6) & 0x3F)
+#define MOVE_FLAGS(move) ((move) >> 12)
+#define MOVE_IS_CAPTURE(move) (MOVE_FLAGS(move) & MOVE_CAPTURE)
+#define MOVE_IS_PROMOTION(move) (MOVE_FLAGS(move) & MOVE_PROMOTION)
+#define MOVE_PROMOTION_PIECE(move) (PIECE_ROOK + (MOVE_FLAGS(move) & 0x03))
+
+/*
+ * Upper bound on the number of legal moves in any position, and for any
+ * single piece (a queen in the middle of an empty board has 27).
+ */
+#define MAX_MOVES 218
+#define MAX_PIECE_MOVES 28
+
+/*
+ * Stages of next_legal_move(): captures (with promotions) come first so a
+ * search can often cut off before the quiet moves are generated at all.
+ */
+#define MOVES_ALL      0
+#define MOVES_CAPTURES 1
+#define MOVES_QUIETS   2
+
+/*
+ * Results of game_status().
+ */
+#define GAME_ONGOING   0
+#define GAME_CHECKMATE 1
+#define GAME_STALEMATE 2
+
+/*
+ * Results of draw_status().
+ */
+#define GAME_REPETITION 3
+#define GAME_FIFTY_MOVES 4
+
+/*
+ * Castling rights, as bits of chess_position_t.castling.
+ */
+#define CASTLE_WHITE_KING  0x01
+#define CASTLE_WHITE_QUEEN 0x02
+#define CASTLE_BLACK_KING  0x04
+#define CASTLE_BLACK_QUEEN 0x08
+
+/*
+ * Marks an empty square field, such as when there is no en passant square.
+ */
+#ifndef NO_SQUARE
+#define NO_SQUARE 0xFF
+#endif
+
+/*
+ * Zobrist hash of a position. The MSP430 build uses 32 bits to halve the
+ * key tables in flash; the host tools use 64.
+ */
+#ifdef __MSP430__
+typedef unsigned long zobrist_t;
+#else
+typedef unsigned long long zobrist_t;
+#endif
+
+/*
+ * Everything that describes a game in progress. Functions that play a move
+ * change the position in place, and unmake_move() takes a move back, so a
+ * search can try its moves out without copying the position.
+ */
+typedef struct {
+    unsigned char board[32];         /* piece ids, two squares per byte */
+    unsigned char king[2];           /* square of each side's king */
+    unsigned char side;              /* side to move, 0 white, 1 black */
+    unsigned char castling;          /* CASTLE_* bits still available */
+    unsigned char ep_square;         /* square a pawn can take en passant on */
+    unsigned char halfmove;          /* moves since the last capture or pawn move */
+    unsigned char phase;             /* material left, see chess_eval.h */
+    short midgame;                   /* white's midgame score, in centipawns */
+    short endgame;                   /* white's endgame score, in centipawns */
+    zobrist_t hash;                  /* kept up to date by make_move() */
+} chess_position_t;
+
+#define KING_SQUARE(pos, side) ((pos)->king[side])
+
+/*
+ * What make_move() changes that can't be worked out again from the position
+ * it leaves, for unmake_move() to put back.
+ */
+typedef struct {
+    unsigned char captured;          /* piece id taken, PIECE_EMPTY if none */
+    unsigned char castling;
+    unsigned char ep_square;
+    unsigned char halfmove;
+} chess_undo_t;
+
+/*
+ * Piece id on a square. Even squares sit in the low nibble of their byte,
+ * odd squares in the high one.
+ */
+#define PIECE_AT(pos, square) \
+    (((pos)->board[(square) >> 1] >> (((square) & 1) << 2)) & 0x0F)
+
+/*
+ * Hashes of the positions played since the last capture or pawn move, for
+ * spotting repetitions. Only the newest HISTORY_SIZE are kept; on the
+ * MSP430 that is 16 plies of 16-bit keys, enough for the usual back and
+ * forth shuffles in 32 bytes of RAM.
+ */
+#ifdef __MSP430__
+#define HISTORY_SIZE 16
+typedef unsigned short history_key_t;
+#else
+#define HISTORY_SIZE 128
+typedef zobrist_t history_key_t;
+#endif
+
+typedef struct {
+    history_key_t keys[HISTORY_SIZE]; /* ring buffer, newest at head - 1 */
+    unsigned char head;
+    unsigned char count;              /* entries since the last irreversible move */
+} chess_history_t;
+
+/**
+ * Reset the board back to starting chess orientation, white to move.
+ * MAKE SURE TO CALL THIS WHEN INITIALIZING BOARD
+ */
+void reset_board(chess_position_t *pos);
+
+/**
+ * Returns whether the game is over for the side to move. Stops at the first
+ * legal move it finds, trying the king first, then taking the checker, then
+ * blocking the check.
+ *
+ * Returns: GAME_ONGOING, GAME_CHECKMATE or GAME_STALEMATE
+ */
+int game_status(chess_position_t *pos);
+
+/**
+ * Returns whether the game is drawn by the fifty move rule or by the
+ * position on the board having come up three times. Only positions with
+ * the same side to move are compared, and only as far back as the last
+ * capture or pawn move.
+ *
+ * Returns: GAME_ONGOING, GAME_REPETITION or GAME_FIFTY_MOVES
+ */
+int draw_status(const chess_history_t *history, const chess_position_t *pos);
+
+/**
+ * Starts the history over with the given position as its only entry.
+ */
+void reset_history(chess_history_t *history, const chess_position_t *pos);
+
+/**
+ * Adds the position to the history. Call it after every move played, with
+ * the position the move led to.
+ */
+void record_position(chess_history_t *history, const chess_position_t *pos);
+
+/**
+ * Returns whether the side to move is in check or not.
+ * Return 1 if in check, 0 if not, -1 if error
+ */
+int in_check(chess_position_t *pos);
+
+/**
+ * Fills the move list with every legal move of the side to move. The board
+ * is left as it was, so there is nothing to revert afterwards.
+ *
+ * The list must have room for MAX_MOVES moves.
+ *
+ * Returns: num of legal moves
+ */
+int generate_legal_moves(chess_position_t *pos, move_t *moves);
+
+/**
+ * Fills the move list with the legal moves of the piece at the given
+ * position. Promotions are listed queen first.
+ *
+ * The list must have room for MAX_PIECE_MOVES moves.
+ *
+ * Returns: num of legal moves, 0 if the square doesn't hold a piece of the
+ * side to move
+ */
+int generate_piece_moves(chess_position_t *pos, int x_pos, int y_pos,
+                         move_t *moves);
+
+/**
+ * Finds the legal move of the side to move that comes after the given one
+ * in the order generate_legal_moves() lists them, or the first one if move
+ * is 0, skipping moves outside the stage: MOVES_CAPTURES for captures and
+ * promotions, MOVES_QUIETS for the rest, or MOVES_ALL for both. Nothing is
+ * kept between calls, so a search can walk through the moves of a position
+ * without a list of them.
+ *
+ * Returns: the next legal move, or 0 if there are no more
+ */
+move_t next_legal_move(chess_position_t *pos, move_t move, int stage);
+
+/**
+ * Checks a move that didn't come from a move list of this position, such
+ * as one remembered from another position, against the rules.
+ *
+ * Returns: 1 if the move is legal here, 0 if not
+ */
+int is_legal_move(chess_position_t *pos, move_t move);
+
+/**
+ * Returns the piece id associated with the input position.
+ *
+ * Returns: piece id at location
+ */
+int get_piece_at_pos(const chess_position_t *pos, int x_pos, int y_pos);
+
+/**
+ * Play a move taken from the legal move list, then hand the turn to the
+ * other side. The hash and the evaluation scores are updated along the way
+ * rather than recomputed. Unless undo is 0, what unmake_move() needs to
+ * take the move back goes in it.
+ */
+void make_move(chess_position_t *pos, move_t move, chess_undo_t *undo);
+
+/**
+ * Take back the move make_move() played last, with the undo it filled in,
+ * and hand the turn back. Moves are taken back newest first.
+ */
+void unmake_move(chess_position_t *pos, move_t move, const chess_undo_t *undo);
+
+/**
+ * Works out the Zobrist hash of the position from scratch. Only needed when
+ * a position is set up by hand; make_move() keeps pos->hash current.
+ *
+ * Returns: hash of the position
+ */
+zobrist_t position_hash(const chess_position_t *pos);
+
+/**
+ * Request that the piece given by parameter at the original location be moved to the new location.
+ * Pawns reaching the last rank are promoted to a queen.
+ *
+ * Returns: 1 if the move was successful, 0 if not
+ */
+int send_move(chess_position_t *pos, int orig_x_pos, int orig_y_pos,
+              int new_x_pos, int new_y_pos);
+
+#endif /* CHESS_FUNCTIONS */
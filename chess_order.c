@@ -0,0 +1,179 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Move ordering: hands the search the moves of a position one at a time,
+ * likeliest cutoffs first, without keeping a list of them.
+ */
+#include <chess_functions.h>
+#include <chess_search.h>
+#include <chess_order.h>
+
+/*
+ * Helper function declarations.
+ */
+static int captured_type(const chess_position_t *pos, move_t move);
+static int capture_passes(const chess_position_t *pos);
+
+/*
+ * Piece type taken in each capture pass, most valuable first. A queen
+ * promotion is worth about as much as taking a queen, so the promotions
+ * that take nothing get the pass after it.
+ */
+static const unsigned char pass_victim[ORDER_KILLERS - ORDER_CAPTURES] = {
+    PIECE_QUEEN, PIECE_EMPTY, PIECE_ROOK, PIECE_BISHOP, PIECE_KNIGHT, PIECE_PAWN
+};
+
+/*
+ * Two quiet moves per ply that cut off in a sibling position, newest first.
+ */
+static move_t killers[SEARCH_MAX_PLY][2];
+
+/**
+ * Forgets the killers of the last search. Call before every search.
+ */
+void reset_move_order() {
+    int i;
+
+    for (i = 0; i < SEARCH_MAX_PLY; i++) {
+        killers[i][0] = 0;
+        killers[i][1] = 0;
+    }
+}
+
+/**
+ * Starts handing out the moves of a position at the given ply, with
+ * hash_move (0 for none) first. Only captures and promotions are handed out
+ * if stage is MOVES_CAPTURES, every move if it is MOVES_ALL.
+ */
+void start_move_order(move_order_t *order, move_t hash_move, int ply,
+                      int stage) {
+    order->hash_move = hash_move;
+    order->last = 0;
+    order->stage = ORDER_HASH;
+    order->ply = ply;
+    order->captures = stage == MOVES_CAPTURES;
+}
+
+/**
+ * Finds the next legal move of the position to search. Each capture pass
+ * walks the captures again from the first, and the killers and the hash
+ * move are checked against the rules before they are handed out, as they
+ * were found in other positions.
+ *
+ * Returns: the next move, or 0 if there are no more
+ */
+move_t next_ordered_move(chess_position_t *pos, move_order_t *order) {
+    move_t move;
+    int pass;
+
+    while (order->stage != ORDER_DONE) {
+        if (order->stage == ORDER_HASH) {
+            order->stage = ORDER_CAPTURES;
+            order->passes = capture_passes(pos);
+            move = order->hash_move;
+            if (move && is_legal_move(pos, move)) return move;
+            order->hash_move = 0;
+        } else if (order->stage < ORDER_KILLERS) {
+            pass = order->stage - ORDER_CAPTURES;
+
+            // one pass over the captures per victim, if there is one to take
+            while ((order->passes & (1 << pass)) &&
+                    (move = next_legal_move(pos, order->last, MOVES_CAPTURES)) != 0) {
+                order->last = move;
+                if (move != order->hash_move && captured_type(pos, move) == pass_victim[pass]) {
+                    return move;
+                }
+            }
+            order->last = 0;
+            order->stage++;
+            if (order->stage == ORDER_KILLERS && order->captures) order->stage = ORDER_DONE;
+        } else if (order->stage < ORDER_QUIETS) {
+            move = order->ply < SEARCH_MAX_PLY ?
+                   killers[order->ply][order->stage - ORDER_KILLERS] : 0;
+            order->stage++;
+            if (move && move != order->hash_move && is_legal_move(pos, move)) return move;
+        } else {
+            while ((move = next_legal_move(pos, order->last, MOVES_QUIETS)) != 0) {
+                order->last = move;
+                if (move == order->hash_move) continue;
+                if (order->ply < SEARCH_MAX_PLY && (move == killers[order->ply][0] ||
+                        move == killers[order->ply][1])) {
+                    continue;
+                }
+                return move;
+            }
+            order->stage = ORDER_DONE;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Remembers a quiet move that caused a cutoff at the given ply as one of
+ * its killers.
+ */
+void record_cutoff(move_t move, int ply) {
+    if (ply < SEARCH_MAX_PLY && killers[ply][0] != move) {
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+/**
+ *
+ * BELOW IS LIST OF INTERNAL FUNCTIONS, THERE SHOULD BE NO NEED TO CALL THESE
+ *
+ */
+/////////////////////////////////////////////////////////////////////////////
+
+
+
+/**
+ * Returns the type of the piece a capture or promotion takes, PIECE_EMPTY
+ * for a promotion that takes nothing.
+ */
+static int captured_type(const chess_position_t *pos, move_t move) {
+    if (MOVE_FLAGS(move) == MOVE_EN_PASSANT) return PIECE_PAWN;
+    return PIECE_TYPE(PIECE_AT(pos, MOVE_TO(move)));
+}
+
+/**
+ * Works out which capture passes can find anything with one look over the
+ * board: a pass needs a piece of its victim on the other side, and the
+ * promotion pass a pawn of the side to move one step from promoting.
+ *
+ * Returns: bit (1 << pass) set for each pass worth walking
+ */
+static int capture_passes(const chess_position_t *pos) {
+    int side = pos->side;
+    int types = 0;
+    int passes = 0;
+    int square;
+    int piece;
+    int i;
+
+    for (square = 0; square < 64; square++) {
+        if (!pos->board[square >> 1]) {
+            square |= 1;
+            continue;
+        }
+        piece = PIECE_AT(pos, square);
+        if (piece == PIECE_EMPTY) continue;
+
+        if (PIECE_SIDE(piece) != side) {
+            types |= 1 << PIECE_TYPE(piece);
+        } else if (PIECE_TYPE(piece) == PIECE_PAWN && SQUARE_X(square) == 6 - 5 * side) {
+            types |= 1 << PIECE_EMPTY;
+        }
+    }
+
+    for (i = 0; i < ORDER_KILLERS - ORDER_CAPTURES; i++) {
+        if (types & (1 << pass_victim[i])) passes |= 1 << i;
+    }
+    return passes;
+}
@@ -0,0 +1,68 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for move ordering: hands the search the moves of a position
+ * one at a time, likeliest cutoffs first, without keeping a list of them.
+ */
+#ifndef CHESS_ORDER
+#define CHESS_ORDER
+
+#include <chess_functions.h>
+
+/*
+ * Stages of a move order, in the order they are tried. The move the
+ * transposition table holds for the position goes first. The captures and
+ * promotions follow in one pass per victim, most valuable first, then the
+ * two killers of the ply and the other quiet moves. Within a pass moves come
+ * in board order: sorting them would take a list.
+ */
+#define ORDER_HASH     0
+#define ORDER_CAPTURES 1
+#define ORDER_KILLERS  7  /* ORDER_CAPTURES + one pass per victim */
+#define ORDER_QUIETS   9
+#define ORDER_DONE     10
+
+/*
+ * Where the moves of one position have got to. It lives in the search's
+ * stack frame for the position, so it is kept small.
+ */
+typedef struct {
+    move_t hash_move;        /* tried first, 0 for none */
+    move_t last;             /* last move of the stage in progress, 0 at its start */
+    unsigned char stage;     /* ORDER_* stage in progress */
+    unsigned char ply;       /* plies from the root, for the killers */
+    unsigned char captures;  /* 1 to stop after the captures and promotions */
+    unsigned char passes;    /* bit per capture pass that may find a move */
+} move_order_t;
+
+/**
+ * Forgets the killers of the last search. Call before every search.
+ */
+void reset_move_order();
+
+/**
+ * Starts handing out the moves of a position at the given ply, with
+ * hash_move (0 for none) first. Only captures and promotions are handed out
+ * if stage is MOVES_CAPTURES, every move if it is MOVES_ALL.
+ */
+void start_move_order(move_order_t *order, move_t hash_move, int ply,
+                      int stage);
+
+/**
+ * Finds the next legal move of the position to search. The position must be
+ * the same as at the last call, so any move tried on it has to be taken
+ * back first.
+ *
+ * Returns: the next move, or 0 if there are no more
+ */
+move_t next_ordered_move(chess_position_t *pos, move_order_t *order);
+
+/**
+ * Remembers a quiet move that caused a cutoff at the given ply as one of
+ * its killers.
+ */
+void record_cutoff(move_t move, int ply);
+
+#endif /* CHESS_ORDER */
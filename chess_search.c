@@ -0,0 +1,393 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Computer opponent: an iterative deepening alpha-beta search over the legal
+ * moves from chess_functions.c.
+ */
+#include <chess_functions.h>
+#include <chess_eval.h>
+#include <chess_order.h>
+#include <chess_ttable.h>
+#include <chess_search.h>
+#include <timer_control.h>
+
+/*
+ * Helper function declarations.
+ */
+static int start_search(chess_position_t *pos, search_result_t *result);
+static int iterate(chess_position_t *pos, unsigned int time_ms,
+                   search_result_t *result);
+static int negamax(chess_position_t *pos, int depth, int ply, int alpha,
+                   int beta);
+static int quiesce(chess_position_t *pos, int depth, int ply, int alpha,
+                   int beta);
+static int poll_clock();
+static int out_of_time();
+static int score_to_tt(int score, int ply);
+static int score_from_tt(int score, int ply);
+
+/* State of the search in progress */
+static unsigned int search_start;
+static unsigned int search_budget;
+static unsigned char search_can_stop;
+static unsigned char search_stopped;
+static unsigned long search_nodes;
+
+/* Best reply found so far to the root move being searched */
+static move_t search_reply;
+
+/* Where search_resume() picks up: the root position and depth, 0 if none */
+static zobrist_t search_hash;
+static unsigned char search_depth = 0;
+
+/* Flag that stops the search as soon as it is set, if any */
+static const volatile unsigned char *search_interrupt = 0;
+
+/**
+ * Searches the position for the best move of the side to move, going one
+ * ply deeper at a time until time_ms milliseconds have passed or
+ * SEARCH_MAX_PLY is reached. The first iteration always finishes unless the
+ * interrupt flag is raised, so a legal move comes back however short the
+ * budget. The position is left as it was.
+ *
+ * Returns: SEARCH_DONE, SEARCH_INTERRUPTED, or SEARCH_NO_MOVE if the side
+ * to move has no legal move
+ */
+int search_best_move(chess_position_t *pos, unsigned int time_ms,
+                     search_result_t *result) {
+    if (!start_search(pos, result)) return SEARCH_NO_MOVE;
+    return iterate(pos, time_ms, result);
+}
+
+/**
+ * Goes on with the last search for another time_ms milliseconds, from the
+ * iteration it was in when it stopped, with result as it left it. Starts a
+ * new search if the position isn't the one last searched.
+ *
+ * Returns: SEARCH_DONE, SEARCH_INTERRUPTED, or SEARCH_NO_MOVE if the side
+ * to move has no legal move
+ */
+int search_resume(chess_position_t *pos, unsigned int time_ms,
+                  search_result_t *result) {
+    // starts a new search here rather than in search_best_move(), to keep
+    // the stack of a ponder search a call shallower
+    if (!search_resumable(pos) && !start_search(pos, result)) return SEARCH_NO_MOVE;
+    return iterate(pos, time_ms, result);
+}
+
+/**
+ * Like search_resume(), for the position after the given move of the side
+ * to move. The move is made on the position for the search and taken back
+ * after it, so a caller can ponder the reply it expects without keeping a
+ * position of its own for it.
+ *
+ * Returns: SEARCH_DONE, SEARCH_INTERRUPTED, or SEARCH_NO_MOVE if the side
+ * to move after the move has no legal move
+ */
+int search_ponder(chess_position_t *pos, move_t move,
+                  unsigned int time_ms, search_result_t *result) {
+    chess_undo_t undo;
+    int status;
+
+    make_move(pos, move, &undo);
+    status = search_resume(pos, time_ms, result);
+    unmake_move(pos, move, &undo);
+    return status;
+}
+
+/**
+ * Returns: 1 if search_resume() would go on with the last search for the
+ * position, 0 if it would start a new one
+ */
+int search_resumable(const chess_position_t *pos) {
+    return search_depth != 0 && pos->hash == search_hash;
+}
+
+/**
+ * Makes the search stop as soon as *flag is non-zero, such as a flag an
+ * interrupt routine raises. The search only reads it, so it is up to the
+ * caller to clear it. Pass 0 to search without one.
+ */
+void set_search_interrupt(const volatile unsigned char *flag) {
+    search_interrupt = flag;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+/**
+ *
+ * BELOW IS LIST OF INTERNAL FUNCTIONS, THERE SHOULD BE NO NEED TO CALL THESE
+ *
+ */
+/////////////////////////////////////////////////////////////////////////////
+
+
+
+/**
+ * Sets up a new search of the position, with result holding the move the
+ * hash table remembers for it if that is legal, or else any legal move.
+ *
+ * Returns: 1 if the side to move has a legal move, 0 if not
+ */
+static int start_search(chess_position_t *pos, search_result_t *result) {
+    const tt_entry_t *entry;
+
+    reset_move_order();
+    tt_new_search();
+
+    // until an iteration finishes, the move the table remembers or any
+    entry = tt_probe(pos->hash);
+    if (entry && is_legal_move(pos, entry->move)) {
+        result->move = entry->move;
+    } else {
+        result->move = next_legal_move(pos, 0, MOVES_ALL);
+    }
+    result->reply = 0;
+    result->score = 0;
+    result->depth = 0;
+    result->nodes = 0;
+
+    search_hash = pos->hash;
+    search_depth = result->move ? 1 : 0;
+    search_nodes = 0;
+
+    return result->move != 0;
+}
+
+/**
+ * Runs the iterations of the search from search_depth on, each one over
+ * every root move with the best of the last one first, until it runs out of
+ * time or depth or is interrupted.
+ *
+ * Returns: SEARCH_DONE or SEARCH_INTERRUPTED
+ */
+static int iterate(chess_position_t *pos, unsigned int time_ms,
+                   search_result_t *result) {
+    move_order_t order;
+    chess_undo_t undo;
+    int alpha;
+    int score;
+    move_t move;
+    move_t best;
+    move_t reply;
+
+    search_start = timer_now();
+    search_budget = time_ms;
+    search_can_stop = result->depth > 0;
+    search_stopped = 0;
+
+    for (; search_depth <= SEARCH_MAX_PLY; search_depth++) {
+        alpha = -SEARCH_INFINITY;
+        best = result->move;
+        reply = result->reply;
+
+        start_move_order(&order, result->move, 0, MOVES_ALL);
+        while ((move = next_ordered_move(pos, &order)) != 0) {
+            search_reply = 0;
+            make_move(pos, move, &undo);
+            if (search_depth > 1) {
+                score = -negamax(pos, search_depth - 1, 1, -SEARCH_INFINITY, -alpha);
+            } else {
+                score = -quiesce(pos, SEARCH_MAX_QUIESCE, 1, -SEARCH_INFINITY, -alpha);
+            }
+            unmake_move(pos, move, &undo);
+            if (search_stopped) break;
+
+            if (score > alpha) {
+                alpha = score;
+                best = move;
+                reply = search_reply;
+            }
+        }
+
+        // an unfinished iteration is thrown away, resuming starts it over
+        if (search_stopped) break;
+
+        result->move = best;
+        result->reply = reply;
+        result->score = alpha;
+        result->depth = search_depth;
+        tt_store(pos->hash, best, search_depth, TT_EXACT, score_to_tt(alpha, 0));
+
+        // once the first iteration is done there is always a move to play
+        search_can_stop = 1;
+
+        // no point looking deeper than a forced mate
+        if (alpha >= SEARCH_MATE - SEARCH_MAX_PLY) search_depth = SEARCH_MAX_PLY;
+        if (out_of_time()) {
+            search_depth++;
+            break;
+        }
+    }
+
+    result->nodes = search_nodes;
+    return search_stopped == SEARCH_INTERRUPTED ? SEARCH_INTERRUPTED : SEARCH_DONE;
+}
+
+/**
+ * Alpha-beta search of the position to the given depth, at least 1. The
+ * moves come from a move order, so only the one being searched is kept, and
+ * each is taken back before the next. The last ply goes straight to
+ * quiesce() to save a stack frame.
+ *
+ * Returns: score of the position for the side to move
+ */
+static int negamax(chess_position_t *pos, int depth, int ply, int alpha,
+                   int beta) {
+    move_order_t order;
+    chess_undo_t undo;
+    const tt_entry_t *entry;
+    int best = -SEARCH_INFINITY;
+    int bound = TT_UPPER;
+    int score;
+    move_t move;
+    move_t best_move = 0;
+    move_t hash_move = 0;
+
+    if (poll_clock()) return 0;
+
+    if (pos->halfmove >= 100) return 0;
+
+    // a deep enough search of this position already may settle it
+    entry = tt_probe(pos->hash);
+    if (entry) {
+        hash_move = entry->move;
+        if (ply == 1) search_reply = hash_move;
+        if (entry->depth >= depth) {
+            score = score_from_tt(entry->score, ply);
+            if (TT_BOUND(entry) == TT_EXACT) return score;
+            if (TT_BOUND(entry) == TT_LOWER && score >= beta) return score;
+            if (TT_BOUND(entry) == TT_UPPER && score <= alpha) return score;
+        }
+    }
+
+    start_move_order(&order, hash_move, ply, MOVES_ALL);
+    while ((move = next_ordered_move(pos, &order)) != 0) {
+        make_move(pos, move, &undo);
+        if (depth > 1) {
+            score = -negamax(pos, depth - 1, ply + 1, -beta, -alpha);
+        } else {
+            score = -quiesce(pos, SEARCH_MAX_QUIESCE, ply + 1, -beta, -alpha);
+        }
+        unmake_move(pos, move, &undo);
+        if (search_stopped) return 0;
+
+        if (score > best) {
+            best = score;
+            best_move = move;
+            if (ply == 1) search_reply = move;
+            if (score > alpha) {
+                alpha = score;
+                bound = TT_EXACT;
+            }
+            if (alpha >= beta) {
+                if (!MOVE_IS_CAPTURE(move) && !MOVE_IS_PROMOTION(move)) {
+                    record_cutoff(move, ply);
+                }
+                tt_store(pos->hash, move, depth, TT_LOWER,
+                         score_to_tt(best, ply));
+                return best;
+            }
+        }
+    }
+
+    // every score beats -SEARCH_INFINITY, so no best move means no moves
+    if (!best_move) return in_check(pos) ? ply - SEARCH_MATE : 0;
+
+    // a move that never beat alpha is no better a guess than any other
+    tt_store(pos->hash, bound == TT_EXACT ? best_move : 0, depth, bound,
+             score_to_tt(best, ply));
+    return best;
+}
+
+/**
+ * Searches only the captures and promotions of the position, at most depth
+ * plies on, so a score is never taken in the middle of an exchange. The
+ * side to move may stand pat on the evaluation rather than take, even when
+ * in check, and captures static_exchange() says lose material are skipped.
+ *
+ * Returns: score of the position for the side to move
+ */
+static int quiesce(chess_position_t *pos, int depth, int ply, int alpha,
+                   int beta) {
+    move_order_t order;
+    chess_undo_t undo;
+    int best;
+    int score;
+    move_t move;
+
+    if (poll_clock()) return 0;
+
+    if (pos->halfmove >= 100) return 0;
+
+    best = evaluate(pos);
+    if (best >= beta || depth == 0) return best;
+    if (best > alpha) alpha = best;
+
+    start_move_order(&order, 0, ply, MOVES_CAPTURES);
+    while ((move = next_ordered_move(pos, &order)) != 0) {
+        if (static_exchange(pos, move) < 0) continue;
+
+        make_move(pos, move, &undo);
+        score = -quiesce(pos, depth - 1, ply + 1, -beta, -alpha);
+        unmake_move(pos, move, &undo);
+        if (search_stopped) return 0;
+
+        if (score > best) {
+            best = score;
+            if (score > alpha) alpha = score;
+            if (alpha >= beta) break;
+        }
+    }
+    return best;
+}
+
+/**
+ * Counts a node, stops the search if the interrupt flag is up and looks at
+ * the clock every so often once stopping is allowed.
+ *
+ * Returns: non-zero if the search has been stopped, 0 if not
+ */
+static int poll_clock() {
+    search_nodes++;
+    if (search_interrupt && *search_interrupt) {
+        search_stopped = SEARCH_INTERRUPTED;
+    } else if (search_can_stop && (search_nodes & 0x0F) == 0 && out_of_time()) {
+        search_stopped = SEARCH_DONE;
+    }
+    return search_stopped;
+}
+
+/**
+ * Returns whether the time budget of the search is used up.
+ * Returns: 1 if it is, 0 if not
+ */
+static int out_of_time() {
+    return (unsigned int) (timer_now() - search_start) >= search_budget;
+}
+
+/**
+ * Mate scores count plies from the root, but the same position can come up
+ * at any ply, so the table holds them counted from the position instead.
+ *
+ * Returns: score to store in the table
+ */
+static int score_to_tt(int score, int ply) {
+    if (score >= SEARCH_MATE - SEARCH_MAX_PLY) return score + ply;
+    if (score <= SEARCH_MAX_PLY - SEARCH_MATE) return score - ply;
+    return score;
+}
+
+/**
+ * Undoes score_to_tt() for a position found at the given ply.
+ *
+ * Returns: score as seen from the root
+ */
+static int score_from_tt(int score, int ply) {
+    if (score >= SEARCH_MATE - SEARCH_MAX_PLY) return score - ply;
+    if (score <= SEARCH_MAX_PLY - SEARCH_MATE) return score + ply;
+    return score;
+}
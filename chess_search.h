@@ -0,0 +1,135 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for the computer opponent: an iterative deepening alpha-beta
+ * search over the legal moves from chess_functions.c.
+ */
+#ifndef CHESS_SEARCH
+#define CHESS_SEARCH
+
+#include <chess_functions.h>
+
+/*
+ * Search limits, fixed at compile time so the RAM a search takes is known
+ * up front. Moves are made and taken back on the one position and handed
+ * out one at a time by a move order (chess_order.h), so no ply keeps a list
+ * of moves or a copy of the position. On the MSP430 (16-bit ints) a search
+ * takes, by estimate:
+ *
+ *     killers         2 moves x SEARCH_MAX_PLY                     8
+ *     search state    clock, node count, root to resume from      20
+ *     root            iterate(): move order 8, undo 4, saved
+ *                     registers and return address               ~30
+ *     each ply        negamax(), the same and alpha-beta state    ~36
+ *                     x (SEARCH_MAX_PLY - 1)                      36
+ *     quiescence      quiesce() ~30 x SEARCH_MAX_QUIESCE          30
+ *     deepest call    static_exchange(), 5 bytes a piece         ~80
+ *                                                               -----
+ *                                                                ~204
+ *
+ * Every extra ply costs about 36 bytes, and every extra quiescence ply
+ * about 30. A CHESS_VS_BOARD build for the G2553 then comes to about this
+ * much of its 512 bytes:
+ *
+ *     the search, as above                                    ~204
+ *     hash table, 4 entries and its age (chess_ttable.h)        33
+ *     game, history, board's reply and flags (main.c)          102
+ *     LED colors and palette (serial_led_control.h)             66
+ *     buttons, animation and timer                             ~40
+ *     main() and the calls from it down to iterate()           ~30
+ *     an interrupt taken during the deepest call               ~24
+ *                                                           -----
+ *                                                            ~499
+ *
+ * The position stays at 48 bytes: with nothing copied it is only counted
+ * once, and the hash and scores it keeps up to date save the search far
+ * more time than the bytes would buy. CHESS_LED_ASYNC's copy of the frame
+ * takes another ~70 bytes, more than is left, so leave it out of a
+ * CHESS_VS_BOARD build for the G2553; hints built with it do without the
+ * search there (see main.c).
+ */
+#ifdef __MSP430__
+#define SEARCH_MAX_PLY 2
+#define SEARCH_MAX_QUIESCE 1
+#else
+#define SEARCH_MAX_PLY 32
+#define SEARCH_MAX_QUIESCE 16
+#endif
+
+/*
+ * Score of being mated right now; mates further away score a point less per
+ * ply so the quickest one is preferred.
+ */
+#define SEARCH_MATE 30000
+#define SEARCH_INFINITY 32000
+
+/*
+ * Results of search_best_move() and search_resume().
+ */
+#define SEARCH_NO_MOVE     0  /* the side to move has no legal move */
+#define SEARCH_DONE        1  /* out of time or depth, the move is ready */
+#define SEARCH_INTERRUPTED 2  /* the interrupt flag stopped it, it can resume */
+
+/*
+ * What search_best_move() found.
+ */
+typedef struct {
+    move_t move;          /* best move found */
+    move_t reply;         /* best reply to it found, 0 if none */
+    int score;            /* in centipawns, from the mover's point of view */
+    int depth;            /* deepest iteration that finished */
+    unsigned long nodes;  /* positions visited */
+} search_result_t;
+
+/**
+ * Searches the position for the best move of the side to move, going one
+ * ply deeper at a time until time_ms milliseconds have passed or
+ * SEARCH_MAX_PLY is reached. The first iteration always finishes unless the
+ * interrupt flag is raised, so a legal move comes back however short the
+ * budget. The position is left as it was.
+ *
+ * Returns: SEARCH_DONE, SEARCH_INTERRUPTED, or SEARCH_NO_MOVE if the side
+ * to move has no legal move
+ */
+int search_best_move(chess_position_t *pos, unsigned int time_ms,
+                     search_result_t *result);
+
+/**
+ * Goes on with the last search for another time_ms milliseconds, from the
+ * iteration it was in when it stopped, with result as it left it. Starts a
+ * new search if the position isn't the one last searched.
+ *
+ * Returns: SEARCH_DONE, SEARCH_INTERRUPTED, or SEARCH_NO_MOVE if the side
+ * to move has no legal move
+ */
+int search_resume(chess_position_t *pos, unsigned int time_ms,
+                  search_result_t *result);
+
+/**
+ * Like search_resume(), for the position after the given move of the side
+ * to move. The move is made on the position for the search and taken back
+ * after it, so a caller can ponder the reply it expects without keeping a
+ * position of its own for it.
+ *
+ * Returns: SEARCH_DONE, SEARCH_INTERRUPTED, or SEARCH_NO_MOVE if the side
+ * to move after the move has no legal move
+ */
+int search_ponder(chess_position_t *pos, move_t move,
+                  unsigned int time_ms, search_result_t *result);
+
+/**
+ * Returns: 1 if search_resume() would go on with the last search for the
+ * position, 0 if it would start a new one
+ */
+int search_resumable(const chess_position_t *pos);
+
+/**
+ * Makes the search stop as soon as *flag is non-zero, such as a flag an
+ * interrupt routine raises. The search only reads it, so it is up to the
+ * caller to clear it. Pass 0 to search without one.
+ */
+void set_search_interrupt(const volatile unsigned char *flag);
+
+#endif /* CHESS_SEARCH */
@@ -0,0 +1,843 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Constant lookup tables for the move generators, evaluation and
+ * position hash.
+ *
+ * GENERATED BY tools/gen_chess_tables.c, DO NOT EDIT BY HAND.
+ */
+#include <chess_tables.h>
+
+const signed char direction_offset[8] = { 8, -8, 1, -1, 9, 7, -7, -9 };
+
+const unsigned char ray_length[64][8] = {
+    { 7, 0, 7, 0, 7, 0, 0, 0 },
+    { 7, 0, 6, 1, 6, 1, 0, 0 },
+    { 7, 0, 5, 2, 5, 2, 0, 0 },
+    { 7, 0, 4, 3, 4, 3, 0, 0 },
+    { 7, 0, 3, 4, 3, 4, 0, 0 },
+    { 7, 0, 2, 5, 2, 5, 0, 0 },
+    { 7, 0, 1, 6, 1, 6, 0, 0 },
+    { 7, 0, 0, 7, 0, 7, 0, 0 },
+    { 6, 1, 7, 0, 6, 0, 1, 0 },
+    { 6, 1, 6, 1, 6, 1, 1, 1 },
+    { 6, 1, 5, 2, 5, 2, 1, 1 },
+    { 6, 1, 4, 3, 4, 3, 1, 1 },
+    { 6, 1, 3, 4, 3, 4, 1, 1 },
+    { 6, 1, 2, 5, 2, 5, 1, 1 },
+    { 6, 1, 1, 6, 1, 6, 1, 1 },
+    { 6, 1, 0, 7, 0, 6, 0, 1 },
+    { 5, 2, 7, 0, 5, 0, 2, 0 },
+    { 5, 2, 6, 1, 5, 1, 2, 1 },
+    { 5, 2, 5, 2, 5, 2, 2, 2 },
+    { 5, 2, 4, 3, 4, 3, 2, 2 },
+    { 5, 2, 3, 4, 3, 4, 2, 2 },
+    { 5, 2, 2, 5, 2, 5, 2, 2 },
+    { 5, 2, 1, 6, 1, 5, 1, 2 },
+    { 5, 2, 0, 7, 0, 5, 0, 2 },
+    { 4, 3, 7, 0, 4, 0, 3, 0 },
+    { 4, 3, 6, 1, 4, 1, 3, 1 },
+    { 4, 3, 5, 2, 4, 2, 3, 2 },
+    { 4, 3, 4, 3, 4, 3, 3, 3 },
+    { 4, 3, 3, 4, 3, 4, 3, 3 },
+    { 4, 3, 2, 5, 2, 4, 2, 3 },
+    { 4, 3, 1, 6, 1, 4, 1, 3 },
+    { 4, 3, 0, 7, 0, 4, 0, 3 },
+    { 3, 4, 7, 0, 3, 0, 4, 0 },
+    { 3, 4, 6, 1, 3, 1, 4, 1 },
+    { 3, 4, 5, 2, 3, 2, 4, 2 },
+    { 3, 4, 4, 3, 3, 3, 4, 3 },
+    { 3, 4, 3, 4, 3, 3, 3, 4 },
+    { 3, 4, 2, 5, 2, 3, 2, 4 },
+    { 3, 4, 1, 6, 1, 3, 1, 4 },
+    { 3, 4, 0, 7, 0, 3, 0, 4 },
+    { 2, 5, 7, 0, 2, 0, 5, 0 },
+    { 2, 5, 6, 1, 2, 1, 5, 1 },
+    { 2, 5, 5, 2, 2, 2, 5, 2 },
+    { 2, 5, 4, 3, 2, 2, 4, 3 },
+    { 2, 5, 3, 4, 2, 2, 3, 4 },
+    { 2, 5, 2, 5, 2, 2, 2, 5 },
+    { 2, 5, 1, 6, 1, 2, 1, 5 },
+    { 2, 5, 0, 7, 0, 2, 0, 5 },
+    { 1, 6, 7, 0, 1, 0, 6, 0 },
+    { 1, 6, 6, 1, 1, 1, 6, 1 },
+    { 1, 6, 5, 2, 1, 1, 5, 2 },
+    { 1, 6, 4, 3, 1, 1, 4, 3 },
+    { 1, 6, 3, 4, 1, 1, 3, 4 },
+    { 1, 6, 2, 5, 1, 1, 2, 5 },
+    { 1, 6, 1, 6, 1, 1, 1, 6 },
+    { 1, 6, 0, 7, 0, 1, 0, 6 },
+    { 0, 7, 7, 0, 0, 0, 7, 0 },
+    { 0, 7, 6, 1, 0, 0, 6, 1 },
+    { 0, 7, 5, 2, 0, 0, 5, 2 },
+    { 0, 7, 4, 3, 0, 0, 4, 3 },
+    { 0, 7, 3, 4, 0, 0, 3, 4 },
+    { 0, 7, 2, 5, 0, 0, 2, 5 },
+    { 0, 7, 1, 6, 0, 0, 1, 6 },
+    { 0, 7, 0, 7, 0, 0, 0, 7 }
+};
+
+const unsigned long long square_bit[64] = {
+    0x0000000000000001ULL,
+    0x0000000000000002ULL,
+    0x0000000000000004ULL,
+    0x0000000000000008ULL,
+    0x0000000000000010ULL,
+    0x0000000000000020ULL,
+    0x0000000000000040ULL,
+    0x0000000000000080ULL,
+    0x0000000000000100ULL,
+    0x0000000000000200ULL,
+    0x0000000000000400ULL,
+    0x0000000000000800ULL,
+    0x0000000000001000ULL,
+    0x0000000000002000ULL,
+    0x0000000000004000ULL,
+    0x0000000000008000ULL,
+    0x0000000000010000ULL,
+    0x0000000000020000ULL,
+    0x0000000000040000ULL,
+    0x0000000000080000ULL,
+    0x0000000000100000ULL,
+    0x0000000000200000ULL,
+    0x0000000000400000ULL,
+    0x0000000000800000ULL,
+    0x0000000001000000ULL,
+    0x0000000002000000ULL,
+    0x0000000004000000ULL,
+    0x0000000008000000ULL,
+    0x0000000010000000ULL,
+    0x0000000020000000ULL,
+    0x0000000040000000ULL,
+    0x0000000080000000ULL,
+    0x0000000100000000ULL,
+    0x0000000200000000ULL,
+    0x0000000400000000ULL,
+    0x0000000800000000ULL,
+    0x0000001000000000ULL,
+    0x0000002000000000ULL,
+    0x0000004000000000ULL,
+    0x0000008000000000ULL,
+    0x0000010000000000ULL,
+    0x0000020000000000ULL,
+    0x0000040000000000ULL,
+    0x0000080000000000ULL,
+    0x0000100000000000ULL,
+    0x0000200000000000ULL,
+    0x0000400000000000ULL,
+    0x0000800000000000ULL,
+    0x0001000000000000ULL,
+    0x0002000000000000ULL,
+    0x0004000000000000ULL,
+    0x0008000000000000ULL,
+    0x0010000000000000ULL,
+    0x0020000000000000ULL,
+    0x0040000000000000ULL,
+    0x0080000000000000ULL,
+    0x0100000000000000ULL,
+    0x0200000000000000ULL,
+    0x0400000000000000ULL,
+    0x0800000000000000ULL,
+    0x1000000000000000ULL,
+    0x2000000000000000ULL,
+    0x4000000000000000ULL,
+    0x8000000000000000ULL
+};
+
+const unsigned char knight_targets[64][9] = {
+    { 10, 17, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 11, 18, 16, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 12, 19,  8, 17, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 13, 20,  9, 18, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 14, 21, 10, 19, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 15, 22, 11, 20, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 23, 12, 21, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 13, 22, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 18, 25,  2, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 19, 26, 24,  3, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 20, 27, 16, 25,  4,  0, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 21, 28, 17, 26,  5,  1, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 22, 29, 18, 27,  6,  2, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 23, 30, 19, 28,  7,  3, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 31, 20, 29,  4, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 21, 30,  5, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 26, 33, 10,  1, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 27, 34, 32, 11,  2,  0, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 28, 35, 24, 33, 12,  3,  8,  1, NO_SQUARE },
+    { 29, 36, 25, 34, 13,  4,  9,  2, NO_SQUARE },
+    { 30, 37, 26, 35, 14,  5, 10,  3, NO_SQUARE },
+    { 31, 38, 27, 36, 15,  6, 11,  4, NO_SQUARE },
+    { 39, 28, 37,  7, 12,  5, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 29, 38, 13,  6, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 34, 41, 18,  9, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 35, 42, 40, 19, 10,  8, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 36, 43, 32, 41, 20, 11, 16,  9, NO_SQUARE },
+    { 37, 44, 33, 42, 21, 12, 17, 10, NO_SQUARE },
+    { 38, 45, 34, 43, 22, 13, 18, 11, NO_SQUARE },
+    { 39, 46, 35, 44, 23, 14, 19, 12, NO_SQUARE },
+    { 47, 36, 45, 15, 20, 13, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 37, 46, 21, 14, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 42, 49, 26, 17, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 43, 50, 48, 27, 18, 16, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 44, 51, 40, 49, 28, 19, 24, 17, NO_SQUARE },
+    { 45, 52, 41, 50, 29, 20, 25, 18, NO_SQUARE },
+    { 46, 53, 42, 51, 30, 21, 26, 19, NO_SQUARE },
+    { 47, 54, 43, 52, 31, 22, 27, 20, NO_SQUARE },
+    { 55, 44, 53, 23, 28, 21, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 45, 54, 29, 22, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 50, 57, 34, 25, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 51, 58, 56, 35, 26, 24, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 52, 59, 48, 57, 36, 27, 32, 25, NO_SQUARE },
+    { 53, 60, 49, 58, 37, 28, 33, 26, NO_SQUARE },
+    { 54, 61, 50, 59, 38, 29, 34, 27, NO_SQUARE },
+    { 55, 62, 51, 60, 39, 30, 35, 28, NO_SQUARE },
+    { 63, 52, 61, 31, 36, 29, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 53, 62, 37, 30, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 58, 42, 33, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 59, 43, 34, 32, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 60, 56, 44, 35, 40, 33, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 61, 57, 45, 36, 41, 34, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 62, 58, 46, 37, 42, 35, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 63, 59, 47, 38, 43, 36, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 60, 39, 44, 37, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 61, 45, 38, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 50, 41, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 51, 42, 40, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 52, 43, 48, 41, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 53, 44, 49, 42, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 54, 45, 50, 43, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 55, 46, 51, 44, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 47, 52, 45, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 53, 46, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE }
+};
+
+const unsigned char king_targets[64][9] = {
+    {  8,  1,  9, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    {  9,  2,  0, 10,  8, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 10,  3,  1, 11,  9, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 11,  4,  2, 12, 10, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 12,  5,  3, 13, 11, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 13,  6,  4, 14, 12, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 14,  7,  5, 15, 13, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 15,  6, 14, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 16,  0,  9, 17,  1, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 17,  1, 10,  8, 18, 16,  2,  0, NO_SQUARE },
+    { 18,  2, 11,  9, 19, 17,  3,  1, NO_SQUARE },
+    { 19,  3, 12, 10, 20, 18,  4,  2, NO_SQUARE },
+    { 20,  4, 13, 11, 21, 19,  5,  3, NO_SQUARE },
+    { 21,  5, 14, 12, 22, 20,  6,  4, NO_SQUARE },
+    { 22,  6, 15, 13, 23, 21,  7,  5, NO_SQUARE },
+    { 23,  7, 14, 22,  6, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 24,  8, 17, 25,  9, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 25,  9, 18, 16, 26, 24, 10,  8, NO_SQUARE },
+    { 26, 10, 19, 17, 27, 25, 11,  9, NO_SQUARE },
+    { 27, 11, 20, 18, 28, 26, 12, 10, NO_SQUARE },
+    { 28, 12, 21, 19, 29, 27, 13, 11, NO_SQUARE },
+    { 29, 13, 22, 20, 30, 28, 14, 12, NO_SQUARE },
+    { 30, 14, 23, 21, 31, 29, 15, 13, NO_SQUARE },
+    { 31, 15, 22, 30, 14, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 32, 16, 25, 33, 17, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 33, 17, 26, 24, 34, 32, 18, 16, NO_SQUARE },
+    { 34, 18, 27, 25, 35, 33, 19, 17, NO_SQUARE },
+    { 35, 19, 28, 26, 36, 34, 20, 18, NO_SQUARE },
+    { 36, 20, 29, 27, 37, 35, 21, 19, NO_SQUARE },
+    { 37, 21, 30, 28, 38, 36, 22, 20, NO_SQUARE },
+    { 38, 22, 31, 29, 39, 37, 23, 21, NO_SQUARE },
+    { 39, 23, 30, 38, 22, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 40, 24, 33, 41, 25, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 41, 25, 34, 32, 42, 40, 26, 24, NO_SQUARE },
+    { 42, 26, 35, 33, 43, 41, 27, 25, NO_SQUARE },
+    { 43, 27, 36, 34, 44, 42, 28, 26, NO_SQUARE },
+    { 44, 28, 37, 35, 45, 43, 29, 27, NO_SQUARE },
+    { 45, 29, 38, 36, 46, 44, 30, 28, NO_SQUARE },
+    { 46, 30, 39, 37, 47, 45, 31, 29, NO_SQUARE },
+    { 47, 31, 38, 46, 30, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 48, 32, 41, 49, 33, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 49, 33, 42, 40, 50, 48, 34, 32, NO_SQUARE },
+    { 50, 34, 43, 41, 51, 49, 35, 33, NO_SQUARE },
+    { 51, 35, 44, 42, 52, 50, 36, 34, NO_SQUARE },
+    { 52, 36, 45, 43, 53, 51, 37, 35, NO_SQUARE },
+    { 53, 37, 46, 44, 54, 52, 38, 36, NO_SQUARE },
+    { 54, 38, 47, 45, 55, 53, 39, 37, NO_SQUARE },
+    { 55, 39, 46, 54, 38, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 56, 40, 49, 57, 41, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 57, 41, 50, 48, 58, 56, 42, 40, NO_SQUARE },
+    { 58, 42, 51, 49, 59, 57, 43, 41, NO_SQUARE },
+    { 59, 43, 52, 50, 60, 58, 44, 42, NO_SQUARE },
+    { 60, 44, 53, 51, 61, 59, 45, 43, NO_SQUARE },
+    { 61, 45, 54, 52, 62, 60, 46, 44, NO_SQUARE },
+    { 62, 46, 55, 53, 63, 61, 47, 45, NO_SQUARE },
+    { 63, 47, 54, 62, 46, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 48, 57, 49, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 49, 58, 56, 50, 48, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 50, 59, 57, 51, 49, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 51, 60, 58, 52, 50, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 52, 61, 59, 53, 51, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 53, 62, 60, 54, 52, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 54, 63, 61, 55, 53, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE },
+    { 55, 62, 54, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE, NO_SQUARE }
+};
+
+const short pst_midgame[6][64] = {
+    {
+          82,   82,   82,   82,   82,   82,   82,   82,
+          60,  120,  106,   67,   59,   62,   81,   47,
+          70,  115,   85,   85,   72,   78,   78,   56,
+          57,   92,   88,   99,   94,   77,   80,   55,
+          59,   99,   94,  105,  103,   88,   95,   68,
+          62,  107,  138,  147,  113,  108,   89,   76,
+          71,  116,  208,  150,  177,  143,  216,  180,
+          82,   82,   82,   82,   82,   82,   82,   82
+    },
+    {
+         451,  440,  484,  493,  494,  478,  464,  458,
+         406,  471,  488,  476,  468,  457,  461,  433,
+         444,  472,  477,  480,  460,  461,  452,  432,
+         454,  483,  470,  486,  476,  465,  451,  441,
+         457,  469,  512,  501,  503,  484,  466,  453,
+         493,  538,  522,  494,  513,  503,  496,  472,
+         521,  503,  544,  557,  539,  535,  509,  504,
+         520,  508,  486,  540,  528,  509,  519,  509
+    },
+    {
+         314,  318,  309,  320,  304,  279,  316,  232,
+         318,  323,  355,  336,  334,  325,  284,  308,
+         321,  362,  354,  356,  347,  349,  328,  314,
+         329,  358,  356,  365,  350,  353,  341,  324,
+         359,  355,  406,  374,  390,  356,  354,  328,
+         381,  410,  466,  421,  402,  374,  397,  290,
+         320,  344,  399,  360,  373,  409,  296,  264,
+         230,  322,  240,  398,  288,  303,  248,  170
+    },
+    {
+         344,  326,  353,  352,  344,  351,  362,  332,
+         366,  398,  386,  372,  365,  381,  380,  369,
+         375,  383,  392,  379,  380,  380,  380,  365,
+         369,  375,  377,  399,  391,  378,  378,  359,
+         363,  372,  402,  402,  415,  384,  370,  361,
+         363,  402,  415,  400,  405,  408,  402,  349,
+         318,  383,  424,  395,  352,  347,  381,  339,
+         357,  372,  323,  340,  328,  283,  369,  336
+    },
+    {
+         975,  994, 1000, 1010, 1035, 1016, 1007, 1024,
+        1026, 1022, 1040, 1033, 1027, 1036, 1017,  990,
+        1030, 1039, 1027, 1020, 1023, 1014, 1027, 1011,
+        1022, 1028, 1021, 1023, 1015, 1016,  999, 1016,
+        1026, 1023, 1042, 1024, 1009, 1009,  998,  998,
+        1082, 1072, 1081, 1054, 1033, 1032, 1008, 1012,
+        1079, 1053, 1082, 1009, 1026, 1020,  986, 1001,
+        1070, 1068, 1069, 1084, 1037, 1054, 1025,  997
+    },
+    {
+          14,   24,  -28,    8,  -54,   12,   36,  -15,
+           8,    9,  -16,  -43,  -64,   -8,    7,    1,
+         -27,  -15,  -30,  -44,  -46,  -22,  -14,  -14,
+         -51,  -33,  -44,  -46,  -39,  -27,   -1,  -49,
+         -36,  -14,  -25,  -30,  -27,  -12,  -20,  -17,
+         -22,   22,    6,  -20,  -16,    2,   24,   -9,
+         -29,  -38,   -4,   -8,   -7,  -20,   -1,   29,
+          13,    2,  -34,  -56,  -15,   16,   23,  -65
+    }
+};
+
+const short pst_endgame[6][64] = {
+    {
+          94,   94,   94,   94,   94,   94,   94,   94,
+          87,   96,   94,  107,  104,  102,  102,  107,
+          86,   93,   89,   94,   95,   88,  101,   98,
+          93,   97,   86,   87,   87,   91,  103,  107,
+         111,  111,   98,   92,   99,  107,  118,  126,
+         178,  176,  147,  150,  161,  179,  194,  188,
+         281,  259,  226,  241,  228,  252,  267,  272,
+          94,   94,   94,   94,   94,   94,   94,   94
+    },
+    {
+         492,  516,  499,  507,  511,  515,  514,  503,
+         509,  501,  503,  503,  514,  512,  506,  506,
+         496,  504,  500,  505,  511,  507,  512,  508,
+         501,  504,  506,  507,  516,  520,  517,  515,
+         514,  511,  513,  514,  513,  525,  515,  516,
+         509,  507,  509,  516,  517,  519,  519,  519,
+         515,  520,  515,  509,  523,  525,  525,  523,
+         517,  520,  524,  524,  527,  530,  522,  525
+    },
+    {
+         217,  231,  263,  259,  266,  258,  230,  252,
+         237,  258,  261,  279,  276,  271,  261,  239,
+         259,  261,  278,  291,  296,  280,  278,  258,
+         263,  285,  298,  297,  306,  297,  275,  263,
+         263,  289,  292,  303,  303,  303,  284,  264,
+         240,  262,  272,  280,  290,  291,  261,  257,
+         229,  257,  256,  272,  279,  256,  273,  256,
+         182,  218,  254,  250,  253,  268,  243,  223
+    },
+    {
+         280,  292,  281,  288,  292,  274,  288,  274,
+         270,  282,  288,  301,  296,  290,  279,  283,
+         282,  290,  300,  310,  307,  305,  294,  285,
+         288,  294,  307,  304,  316,  310,  300,  291,
+         299,  300,  307,  311,  306,  309,  306,  294,
+         301,  297,  303,  295,  296,  297,  289,  299,
+         283,  293,  284,  294,  285,  304,  293,  289,
+         273,  280,  288,  290,  289,  286,  276,  283
+    },
+    {
+         895,  916,  904,  931,  893,  914,  908,  903,
+         904,  900,  913,  920,  920,  906,  913,  914,
+         941,  946,  953,  945,  942,  951,  909,  920,
+         959,  975,  970,  967,  983,  955,  964,  918,
+         972,  993,  976,  993,  981,  960,  958,  939,
+         945,  955,  971,  983,  985,  945,  942,  916,
+         936,  966,  961,  994,  977,  968,  956,  919,
+         956,  946,  955,  963,  963,  958,  958,  927
+    },
+    {
+         -43,  -24,  -14,  -28,  -11,  -21,  -34,  -53,
+         -17,   -5,    4,   14,   13,    4,  -11,  -27,
+          -9,    7,   16,   23,   21,   11,   -3,  -19,
+         -11,    9,   23,   27,   24,   21,   -4,  -18,
+           3,   26,   33,   26,   27,   24,   22,   -8,
+          13,   44,   45,   20,   15,   23,   17,   10,
+          11,   23,   38,   17,   17,   14,   17,  -12,
+         -17,    4,   15,  -11,  -18,  -18,  -35,  -74
+    }
+};
+
+const zobrist_t zobrist_pieces[2][6][64] = {
+    {
+        {
+            ZOBRIST_KEY(0xAD5DB60BUL, 0x4C5D45D4UL), ZOBRIST_KEY(0xBEDAF65DUL, 0x8707906EUL),
+            ZOBRIST_KEY(0x0A1FE02DUL, 0x6C6DD3D0UL), ZOBRIST_KEY(0x9706F44DUL, 0x6F0B43B4UL),
+            ZOBRIST_KEY(0xFDF3C3D8UL, 0xA31FA376UL), ZOBRIST_KEY(0x481E64CCUL, 0x0CD21571UL),
+            ZOBRIST_KEY(0x20B83DCCUL, 0x23713DFAUL), ZOBRIST_KEY(0x78513431UL, 0x5B1EDC82UL),
+            ZOBRIST_KEY(0x7AA278FEUL, 0xECA0B1E4UL), ZOBRIST_KEY(0x570A4617UL, 0x426E8317UL),
+            ZOBRIST_KEY(0xD38DEAB3UL, 0xE2C7E7F7UL), ZOBRIST_KEY(0xE8E9C73BUL, 0x7A573657UL),
+            ZOBRIST_KEY(0x579B01B7UL, 0x46B1A2B0UL), ZOBRIST_KEY(0x1166CA4DUL, 0xAE545252UL),
+            ZOBRIST_KEY(0x1BE7F175UL, 0xC089F047UL), ZOBRIST_KEY(0x99505F62UL, 0x4166747CUL),
+            ZOBRIST_KEY(0xEB6D89BBUL, 0x9B6ED8AAUL), ZOBRIST_KEY(0xF5D67549UL, 0x1F586D7BUL),
+            ZOBRIST_KEY(0xBA59E109UL, 0xCEFE84D9UL), ZOBRIST_KEY(0x681AB9D7UL, 0x5AEBF6EAUL),
+            ZOBRIST_KEY(0x62D969A4UL, 0x129A9F24UL), ZOBRIST_KEY(0x74961E93UL, 0x526F20E2UL),
+            ZOBRIST_KEY(0x0E87D5A8UL, 0xECA0D509UL), ZOBRIST_KEY(0xEC286AFAUL, 0x765DE909UL),
+            ZOBRIST_KEY(0xB803B3E8UL, 0x1516FA8EUL), ZOBRIST_KEY(0x1BF8FFEBUL, 0x12F0477CUL),
+            ZOBRIST_KEY(0xB42A39CCUL, 0x02ED848DUL), ZOBRIST_KEY(0x03033E63UL, 0xEC499479UL),
+            ZOBRIST_KEY(0xFEB12915UL, 0x3FDA9651UL), ZOBRIST_KEY(0x44B38F52UL, 0xC2CB246FUL),
+            ZOBRIST_KEY(0x77052597UL, 0x241FD422UL), ZOBRIST_KEY(0x65CC6C2DUL, 0x4F22FEFFUL),
+            ZOBRIST_KEY(0x984CADF4UL, 0x365C51E9UL), ZOBRIST_KEY(0xB074A29BUL, 0xB4578F85UL),
+            ZOBRIST_KEY(0x6950716AUL, 0x7A91A86CUL), ZOBRIST_KEY(0x19D27EAFUL, 0xD9479350UL),
+            ZOBRIST_KEY(0x478FFD11UL, 0x34CB1FCDUL), ZOBRIST_KEY(0x3F3A906DUL, 0x1009109EUL),
+            ZOBRIST_KEY(0x3010D34DUL, 0xEB04D425UL), ZOBRIST_KEY(0xD522D895UL, 0x0B13B8FBUL),
+            ZOBRIST_KEY(0x6AB05470UL, 0x0463CA78UL), ZOBRIST_KEY(0x594069F3UL, 0xEFC624A4UL),
+            ZOBRIST_KEY(0x2EE1515DUL, 0x21C28506UL), ZOBRIST_KEY(0x39CAA952UL, 0x3762F621UL),
+            ZOBRIST_KEY(0x90D49BA9UL, 0x515D124CUL), ZOBRIST_KEY(0xE3482219UL, 0x36BB02B5UL),
+            ZOBRIST_KEY(0x3893C473UL, 0x48227758UL), ZOBRIST_KEY(0x0CB732BAUL, 0x5A3C9445UL),
+            ZOBRIST_KEY(0x4B09F5AAUL, 0x7B398602UL), ZOBRIST_KEY(0x1141CC90UL, 0xE12B7825UL),
+            ZOBRIST_KEY(0xB77D5DE0UL, 0x85F26FC8UL), ZOBRIST_KEY(0xA04F22B1UL, 0xAD1B59C1UL),
+            ZOBRIST_KEY(0xE10FC532UL, 0x942F357FUL), ZOBRIST_KEY(0xCED9D7FFUL, 0x335AB2BBUL),
+            ZOBRIST_KEY(0xFC293894UL, 0x53000277UL), ZOBRIST_KEY(0x70CCB666UL, 0x61F1F473UL),
+            ZOBRIST_KEY(0x6A53C92EUL, 0x60D0FA2AUL), ZOBRIST_KEY(0xD0D58D52UL, 0x88553C35UL),
+            ZOBRIST_KEY(0x46DD7193UL, 0x5E14B7F2UL), ZOBRIST_KEY(0x7BBE2CDFUL, 0xF5FA016DUL),
+            ZOBRIST_KEY(0x1AE498CFUL, 0xCC9305B9UL), ZOBRIST_KEY(0xCF43FF52UL, 0xAC63EF37UL),
+            ZOBRIST_KEY(0x8F854403UL, 0xD20C1461UL), ZOBRIST_KEY(0x397735B9UL, 0x8A5E2709UL)
+        },
+        {
+            ZOBRIST_KEY(0xD6C7F980UL, 0x555016D3UL), ZOBRIST_KEY(0x572E9FC9UL, 0x8C47F6C7UL),
+            ZOBRIST_KEY(0x12115416UL, 0x57483006UL), ZOBRIST_KEY(0xFED6C013UL, 0xB16E1AC0UL),
+            ZOBRIST_KEY(0xAC55480FUL, 0xC0909F7EUL), ZOBRIST_KEY(0x572A4682UL, 0x8C332A48UL),
+            ZOBRIST_KEY(0xEEB15BDDUL, 0xB5B70BC5UL), ZOBRIST_KEY(0x3F8A118FUL, 0x3D4CCC2BUL),
+            ZOBRIST_KEY(0xC902B8F9UL, 0xF728FDABUL), ZOBRIST_KEY(0xF4D5B4CDUL, 0xF7FD83EDUL),
+            ZOBRIST_KEY(0x1C67C625UL, 0x1F0EC2DEUL), ZOBRIST_KEY(0xE1DCD862UL, 0x5803C545UL),
+            ZOBRIST_KEY(0x5F39F5D4UL, 0xDFAF37FEUL), ZOBRIST_KEY(0xAFEA0771UL, 0x8BA8FB79UL),
+            ZOBRIST_KEY(0x1E0675D4UL, 0xA3AF17BDUL), ZOBRIST_KEY(0x42E7BDA2UL, 0xD6F5377BUL),
+            ZOBRIST_KEY(0x7FDA235CUL, 0xE8ED7C8CUL), ZOBRIST_KEY(0xBC2EF799UL, 0x15882BFAUL),
+            ZOBRIST_KEY(0xE08CE149UL, 0x75A8D23DUL), ZOBRIST_KEY(0x3BA40B35UL, 0xD2B35BA3UL),
+            ZOBRIST_KEY(0x15DBC8E4UL, 0xAEB8119BUL), ZOBRIST_KEY(0xC3705BF3UL, 0x050E683BUL),
+            ZOBRIST_KEY(0x5649C9E9UL, 0xE0986949UL), ZOBRIST_KEY(0x4EEE9A37UL, 0x894A6F1DUL),
+            ZOBRIST_KEY(0x5CB284E2UL, 0xB6AC608FUL), ZOBRIST_KEY(0xFCC69609UL, 0x9289073AUL),
+            ZOBRIST_KEY(0x0C1FD690UL, 0x71E43139UL), ZOBRIST_KEY(0x420CDBD1UL, 0xA805480EUL),
+            ZOBRIST_KEY(0xDE6884E9UL, 0xAE84C702UL), ZOBRIST_KEY(0xA8903E10UL, 0x3EC1CF66UL),
+            ZOBRIST_KEY(0x51D7DCA5UL, 0xD19842DDUL), ZOBRIST_KEY(0xD1F9EBBEUL, 0xE9AA67C3UL),
+            ZOBRIST_KEY(0xA4A73283UL, 0x196E3668UL), ZOBRIST_KEY(0x57191D6AUL, 0xB5A0A7F8UL),
+            ZOBRIST_KEY(0x461159C1UL, 0x3C4D935BUL), ZOBRIST_KEY(0x229BC804UL, 0xD9DE4B15UL),
+            ZOBRIST_KEY(0x72A8D270UL, 0x93CC8C4BUL), ZOBRIST_KEY(0x2916F6ADUL, 0xC55C1469UL),
+            ZOBRIST_KEY(0x4B11D7DBUL, 0x8CE1583EUL), ZOBRIST_KEY(0x7960836FUL, 0xC11F29C8UL),
+            ZOBRIST_KEY(0x61374933UL, 0x24C58F68UL), ZOBRIST_KEY(0xA5DF5439UL, 0xC3A5989FUL),
+            ZOBRIST_KEY(0x23C2066BUL, 0xEBA9F1F7UL), ZOBRIST_KEY(0x10E1E68BUL, 0xBA8F9DA5UL),
+            ZOBRIST_KEY(0x8691786EUL, 0xFE019D33UL), ZOBRIST_KEY(0x8A92D09AUL, 0x32462E69UL),
+            ZOBRIST_KEY(0x0285D107UL, 0xE78ACC6FUL), ZOBRIST_KEY(0xC74AA14FUL, 0x847D42CBUL),
+            ZOBRIST_KEY(0xB74E2C12UL, 0x32D81925UL), ZOBRIST_KEY(0x6FBD1663UL, 0x0E53DBD9UL),
+            ZOBRIST_KEY(0x4A1D746BUL, 0xB7982D44UL), ZOBRIST_KEY(0xACFB3387UL, 0x988492B6UL),
+            ZOBRIST_KEY(0x64D6A44BUL, 0xF80D3277UL), ZOBRIST_KEY(0x97A73F72UL, 0x0FA740A5UL),
+            ZOBRIST_KEY(0x098005F3UL, 0xD408A57AUL), ZOBRIST_KEY(0x12651FC3UL, 0x1E44A882UL),
+            ZOBRIST_KEY(0x1BC6CE65UL, 0x04EE46CBUL), ZOBRIST_KEY(0xAE7E4015UL, 0xC45C31BBUL),
+            ZOBRIST_KEY(0xF12FA1C1UL, 0x8CB439E0UL), ZOBRIST_KEY(0x5E41AC47UL, 0x6F931998UL),
+            ZOBRIST_KEY(0x9F805D1BUL, 0x6D6DF690UL), ZOBRIST_KEY(0x860B5EB0UL, 0xC2454CAEUL),
+            ZOBRIST_KEY(0x5D13EE43UL, 0x2752D825UL), ZOBRIST_KEY(0x5EA88E7AUL, 0x598BFF82UL)
+        },
+        {
+            ZOBRIST_KEY(0x87CA92BEUL, 0x5763E30AUL), ZOBRIST_KEY(0x04076D17UL, 0xF94EB038UL),
+            ZOBRIST_KEY(0x527C3209UL, 0xD3AE020CUL), ZOBRIST_KEY(0x0629E166UL, 0xB4935C65UL),
+            ZOBRIST_KEY(0xE020918EUL, 0xA519C3FAUL), ZOBRIST_KEY(0xE075C81CUL, 0x8B0254D8UL),
+            ZOBRIST_KEY(0xA4A75E25UL, 0x11491071UL), ZOBRIST_KEY(0x74A78C49UL, 0x1EB52602UL),
+            ZOBRIST_KEY(0xDD04B147UL, 0x148C91D1UL), ZOBRIST_KEY(0xC369B36AUL, 0xCC1C74EEUL),
+            ZOBRIST_KEY(0x897D2DD6UL, 0xB0049A11UL), ZOBRIST_KEY(0x06C5EE9AUL, 0xFC42B4ADUL),
+            ZOBRIST_KEY(0x872D9F64UL, 0x0C2DFA59UL), ZOBRIST_KEY(0x44C48319UL, 0xBB8C1B05UL),
+            ZOBRIST_KEY(0x3716C481UL, 0xD2C80608UL), ZOBRIST_KEY(0xF173B6A6UL, 0x9AFBB029UL),
+            ZOBRIST_KEY(0x31B74B5EUL, 0x139314F3UL), ZOBRIST_KEY(0x859C6A51UL, 0x968BFDB7UL),
+            ZOBRIST_KEY(0x63B82D19UL, 0x8AA88589UL), ZOBRIST_KEY(0x6FEE95DBUL, 0x375C9156UL),
+            ZOBRIST_KEY(0x9B324DE7UL, 0xF15D0D8BUL), ZOBRIST_KEY(0x3755D21EUL, 0x91509804UL),
+            ZOBRIST_KEY(0x61F015CBUL, 0x44E38685UL), ZOBRIST_KEY(0x38885193UL, 0x66177711UL),
+            ZOBRIST_KEY(0xB3FCF467UL, 0x412D1A76UL), ZOBRIST_KEY(0x37813D30UL, 0x2349827FUL),
+            ZOBRIST_KEY(0xC0F185FAUL, 0x1D37E871UL), ZOBRIST_KEY(0x48C9E3A6UL, 0x8230D42FUL),
+            ZOBRIST_KEY(0xEC2EC3E8UL, 0x190926EEUL), ZOBRIST_KEY(0xF2E2879AUL, 0xC097653BUL),
+            ZOBRIST_KEY(0x076C290BUL, 0xD20B634AUL), ZOBRIST_KEY(0xC2653727UL, 0xA57FE93BUL),
+            ZOBRIST_KEY(0xE1E22152UL, 0x2D666461UL), ZOBRIST_KEY(0x399BE906UL, 0xE2E6E8B0UL),
+            ZOBRIST_KEY(0x10CD2F70UL, 0x9690491CUL), ZOBRIST_KEY(0x52DE906EUL, 0x711FAD06UL),
+            ZOBRIST_KEY(0xE3C73FBDUL, 0xC7A39143UL), ZOBRIST_KEY(0x05176AB0UL, 0xAA536CA0UL),
+            ZOBRIST_KEY(0x32CAB841UL, 0xBC2A998AUL), ZOBRIST_KEY(0x02F89EC0UL, 0x526EB1E5UL),
+            ZOBRIST_KEY(0x389E23E5UL, 0x33FF18A4UL), ZOBRIST_KEY(0x9DD3AB72UL, 0x3E373278UL),
+            ZOBRIST_KEY(0xC37AD6DAUL, 0x67CA439CUL), ZOBRIST_KEY(0x695D165EUL, 0xA187625EUL),
+            ZOBRIST_KEY(0x79FD7B96UL, 0x95E042E0UL), ZOBRIST_KEY(0x349F4ECBUL, 0x7EC8507DUL),
+            ZOBRIST_KEY(0x82CF7242UL, 0xC8431117UL), ZOBRIST_KEY(0x40265C7DUL, 0x5545EC5CUL),
+            ZOBRIST_KEY(0x09E90821UL, 0x92B8FADAUL), ZOBRIST_KEY(0xC29B1278UL, 0xE2054D67UL),
+            ZOBRIST_KEY(0xB2F9F8B5UL, 0xF1C5CF37UL), ZOBRIST_KEY(0x764782C4UL, 0xE6A4FD20UL),
+            ZOBRIST_KEY(0xF75EF9B4UL, 0x9426F003UL), ZOBRIST_KEY(0x1E566A7EUL, 0xFECE2EE0UL),
+            ZOBRIST_KEY(0xC7FB497FUL, 0xC30A6784UL), ZOBRIST_KEY(0x8007E30CUL, 0x22542C6CUL),
+            ZOBRIST_KEY(0xAB2CED5FUL, 0xA3542192UL), ZOBRIST_KEY(0x40E58825UL, 0x2B1823C7UL),
+            ZOBRIST_KEY(0x919F92BAUL, 0x3DF16D08UL), ZOBRIST_KEY(0x6FD879EAUL, 0xA35DE755UL),
+            ZOBRIST_KEY(0x6D5D96C5UL, 0xCC89706AUL), ZOBRIST_KEY(0x6D426DBFUL, 0x69C26009UL),
+            ZOBRIST_KEY(0xFC2DDFC0UL, 0x9E1124AFUL), ZOBRIST_KEY(0x45A64B92UL, 0x56AD71FEUL)
+        },
+        {
+            ZOBRIST_KEY(0xCC82E8FCUL, 0x64847807UL), ZOBRIST_KEY(0xFDE9BC6EUL, 0x3DA7BC7FUL),
+            ZOBRIST_KEY(0x8FDAE79DUL, 0x0D3D1826UL), ZOBRIST_KEY(0x5F29BBDFUL, 0xC243539EUL),
+            ZOBRIST_KEY(0x40000310UL, 0x3BBCE787UL), ZOBRIST_KEY(0x51506611UL, 0xCB77A6B9UL),
+            ZOBRIST_KEY(0xDCC08A43UL, 0x81B5B04BUL), ZOBRIST_KEY(0x7F6F9E8BUL, 0x4A7EF5C2UL),
+            ZOBRIST_KEY(0x7D0032E4UL, 0x67053ACBUL), ZOBRIST_KEY(0xCA369837UL, 0x35803509UL),
+            ZOBRIST_KEY(0x4FD524D9UL, 0x2A4210FFUL), ZOBRIST_KEY(0x84959AF3UL, 0xC956A4CDUL),
+            ZOBRIST_KEY(0x399EB1DFUL, 0x00CBF7C5UL), ZOBRIST_KEY(0x4502C5E2UL, 0xBBA8008FUL),
+            ZOBRIST_KEY(0xA8B8FE84UL, 0xD4BD3ECCUL), ZOBRIST_KEY(0xA709D248UL, 0x0FE2D3CCUL),
+            ZOBRIST_KEY(0x93C5733AUL, 0x82FD4513UL), ZOBRIST_KEY(0x1AF451BCUL, 0xFB558613UL),
+            ZOBRIST_KEY(0xEBFC5FEBUL, 0x5C311091UL), ZOBRIST_KEY(0x5310F0EEUL, 0x6D58336BUL),
+            ZOBRIST_KEY(0x3543E295UL, 0xA621F9B8UL), ZOBRIST_KEY(0xAE71D0A3UL, 0x7287C0C6UL),
+            ZOBRIST_KEY(0x76B2B25DUL, 0xA01A2ACFUL), ZOBRIST_KEY(0xA20010F0UL, 0x53DA4BDAUL),
+            ZOBRIST_KEY(0x1570E519UL, 0x141F14E4UL), ZOBRIST_KEY(0xB0269462UL, 0xC4D7FBC8UL),
+            ZOBRIST_KEY(0xA1B3BE00UL, 0x63264A9FUL), ZOBRIST_KEY(0x98FBA071UL, 0x7E44805AUL),
+            ZOBRIST_KEY(0xCE077E0CUL, 0xBF1B5634UL), ZOBRIST_KEY(0x6D72F25BUL, 0x821239A2UL),
+            ZOBRIST_KEY(0x57A41696UL, 0xE2A9FA09UL), ZOBRIST_KEY(0x9C2543FDUL, 0xC67E1864UL),
+            ZOBRIST_KEY(0xDC67639BUL, 0x0E17BF3CUL), ZOBRIST_KEY(0xC308F723UL, 0x30411E3DUL),
+            ZOBRIST_KEY(0x88206EECUL, 0x7A80EF33UL), ZOBRIST_KEY(0x6B4481E5UL, 0x26CE3CA0UL),
+            ZOBRIST_KEY(0xAA1B48AEUL, 0xA6B23BBAUL), ZOBRIST_KEY(0xD0CF93EEUL, 0x3281B7A9UL),
+            ZOBRIST_KEY(0xBCA2EDE0UL, 0xD126AD25UL), ZOBRIST_KEY(0x32A811E4UL, 0xD7571B71UL),
+            ZOBRIST_KEY(0x4352252AUL, 0x2CAD8060UL), ZOBRIST_KEY(0xAC311AB6UL, 0x87C93DD5UL),
+            ZOBRIST_KEY(0x7136FF17UL, 0x9EE91CE8UL), ZOBRIST_KEY(0x3D93F5C4UL, 0xDBBD3210UL),
+            ZOBRIST_KEY(0xFDA6F041UL, 0x23BB61E6UL), ZOBRIST_KEY(0x34762DABUL, 0xE28D3028UL),
+            ZOBRIST_KEY(0x19D57E14UL, 0x3F07546EUL), ZOBRIST_KEY(0xEEBBF0A8UL, 0x2B5BF9B2UL),
+            ZOBRIST_KEY(0x92E0A606UL, 0x004CDB73UL), ZOBRIST_KEY(0xBFBEE82FUL, 0x593AFA29UL),
+            ZOBRIST_KEY(0xA58F407FUL, 0x4ED63658UL), ZOBRIST_KEY(0x7D1B7C95UL, 0x3ED13432UL),
+            ZOBRIST_KEY(0xDE662386UL, 0x370E6668UL), ZOBRIST_KEY(0x5A6FD5C4UL, 0xBCBB642EUL),
+            ZOBRIST_KEY(0x7D3DF1CFUL, 0x326FA5D5UL), ZOBRIST_KEY(0xBBE438CEUL, 0xDFE064E9UL),
+            ZOBRIST_KEY(0xCAA08BDFUL, 0xAA7E3DE8UL), ZOBRIST_KEY(0x45954166UL, 0x44A838AAUL),
+            ZOBRIST_KEY(0x6E642485UL, 0x1DE0CC2CUL), ZOBRIST_KEY(0x6EBB9BC6UL, 0x1DD49128UL),
+            ZOBRIST_KEY(0x13A25F8BUL, 0x220FB912UL), ZOBRIST_KEY(0x13367E5AUL, 0x067FC9B0UL),
+            ZOBRIST_KEY(0x0C57E5A1UL, 0x1F384540UL), ZOBRIST_KEY(0x9BF287E8UL, 0xF37237C2UL)
+        },
+        {
+            ZOBRIST_KEY(0xE27D7697UL, 0xBC02101BUL), ZOBRIST_KEY(0x8B01EA84UL, 0xEFD364F6UL),
+            ZOBRIST_KEY(0x26DF2F75UL, 0x3C25F4F9UL), ZOBRIST_KEY(0x618A38AFUL, 0xDE8BA407UL),
+            ZOBRIST_KEY(0x27F82AD5UL, 0x87AB9C62UL), ZOBRIST_KEY(0xCCBE9F1BUL, 0xD5896230UL),
+            ZOBRIST_KEY(0x62C26E92UL, 0xA199819BUL), ZOBRIST_KEY(0xEA0900B0UL, 0xDD59EA24UL),
+            ZOBRIST_KEY(0xC08F4803UL, 0xB0DCF432UL), ZOBRIST_KEY(0x996833DBUL, 0x304F8409UL),
+            ZOBRIST_KEY(0x48F4DCEDUL, 0x60ED022DUL), ZOBRIST_KEY(0xF091FA22UL, 0x0536BBA4UL),
+            ZOBRIST_KEY(0xDA63C0FCUL, 0xCB0F7323UL), ZOBRIST_KEY(0x7B4A47A4UL, 0xDCC40901UL),
+            ZOBRIST_KEY(0xF4B739C1UL, 0x030AA126UL), ZOBRIST_KEY(0xC0725BC5UL, 0xE02D50D3UL),
+            ZOBRIST_KEY(0x1B7121D4UL, 0xBEC7B6A2UL), ZOBRIST_KEY(0x6FAB0F4AUL, 0xA55FF6EAUL),
+            ZOBRIST_KEY(0x4B676497UL, 0x1F3AC4F1UL), ZOBRIST_KEY(0x344A8ADDUL, 0x89162238UL),
+            ZOBRIST_KEY(0xC7C21F01UL, 0xBF9668E1UL), ZOBRIST_KEY(0x7C35C673UL, 0x35E5FEB7UL),
+            ZOBRIST_KEY(0xAE61BF37UL, 0xF4EA6948UL), ZOBRIST_KEY(0xA28E91CEUL, 0x7C269B28UL),
+            ZOBRIST_KEY(0xA8F83413UL, 0x9286D855UL), ZOBRIST_KEY(0x3E4A328BUL, 0x9775C326UL),
+            ZOBRIST_KEY(0xC4874F2AUL, 0x2FADC806UL), ZOBRIST_KEY(0xF77292CEUL, 0x38005C9EUL),
+            ZOBRIST_KEY(0x28EE6055UL, 0x93889A2BUL), ZOBRIST_KEY(0x89463389UL, 0xD0DEF8B8UL),
+            ZOBRIST_KEY(0x13AA5B6FUL, 0x59B47DC5UL), ZOBRIST_KEY(0x46E65C67UL, 0xC15C0693UL),
+            ZOBRIST_KEY(0x4A6272DAUL, 0xF49689E4UL), ZOBRIST_KEY(0xD65F14C0UL, 0x7FFC389DUL),
+            ZOBRIST_KEY(0x5D093F38UL, 0x2A648954UL), ZOBRIST_KEY(0x63F49F6EUL, 0x28471B8AUL),
+            ZOBRIST_KEY(0xDF2E744BUL, 0x5F83C19FUL), ZOBRIST_KEY(0x64EB0B3FUL, 0x57AA51CAUL),
+            ZOBRIST_KEY(0xB206BAA1UL, 0x2B08B1BBUL), ZOBRIST_KEY(0xC80D088BUL, 0x70E908ABUL),
+            ZOBRIST_KEY(0xED84D2E8UL, 0xC1BDC92AUL), ZOBRIST_KEY(0x6CF5F98CUL, 0x0AF7666FUL),
+            ZOBRIST_KEY(0x0705FB23UL, 0x64A72FB9UL), ZOBRIST_KEY(0x2D1632FDUL, 0x8B7FC7A0UL),
+            ZOBRIST_KEY(0x20187900UL, 0xDBBE0DBDUL), ZOBRIST_KEY(0xA7053E7BUL, 0x4BFCF357UL),
+            ZOBRIST_KEY(0x19152A6BUL, 0xEAD8EF9DUL), ZOBRIST_KEY(0xC98E15E6UL, 0xBF5CAC92UL),
+            ZOBRIST_KEY(0xD510112BUL, 0x8D13632BUL), ZOBRIST_KEY(0xBD670D35UL, 0x658B348EUL),
+            ZOBRIST_KEY(0x5971D381UL, 0xA97E480AUL), ZOBRIST_KEY(0x3A2A386CUL, 0x69D04DD8UL),
+            ZOBRIST_KEY(0x411D731EUL, 0x9E6AE5D2UL), ZOBRIST_KEY(0x4BC51593UL, 0x61AF6232UL),
+            ZOBRIST_KEY(0x48518EC4UL, 0x498A8A49UL), ZOBRIST_KEY(0xC23D1BEFUL, 0x7F16B3A5UL),
+            ZOBRIST_KEY(0x3E8E77EEUL, 0xFE845C39UL), ZOBRIST_KEY(0x9BF50856UL, 0xFD40570DUL),
+            ZOBRIST_KEY(0xDFBFFE3EUL, 0x14E27261UL), ZOBRIST_KEY(0x8C1FA9D5UL, 0xEA6B4678UL),
+            ZOBRIST_KEY(0xA3730515UL, 0xA5751DFCUL), ZOBRIST_KEY(0xD5AD3009UL, 0xDBEEEB9DUL),
+            ZOBRIST_KEY(0xC687EFDFUL, 0x7CE9C8DBUL), ZOBRIST_KEY(0xDFEECEC5UL, 0x7CCBC94EUL)
+        },
+        {
+            ZOBRIST_KEY(0x71F8880FUL, 0x9A619DC6UL), ZOBRIST_KEY(0x826A45ECUL, 0xE6E2CB23UL),
+            ZOBRIST_KEY(0x468FC64CUL, 0xAD673146UL), ZOBRIST_KEY(0xE3A45E85UL, 0x3B0C8089UL),
+            ZOBRIST_KEY(0x693CC3F5UL, 0xFC08E294UL), ZOBRIST_KEY(0x3CC74FF6UL, 0x1BE8AF6EUL),
+            ZOBRIST_KEY(0xF4E35EE0UL, 0x67C7990FUL), ZOBRIST_KEY(0xFAE0787EUL, 0xBF6135B2UL),
+            ZOBRIST_KEY(0xEA97F524UL, 0x5C88D6F6UL), ZOBRIST_KEY(0x937560EEUL, 0xA42027ACUL),
+            ZOBRIST_KEY(0x7EF8845DUL, 0x442D37CAUL), ZOBRIST_KEY(0x5114D4FEUL, 0x61DB6C01UL),
+            ZOBRIST_KEY(0xAF85DEB3UL, 0xE95FFE73UL), ZOBRIST_KEY(0xA8D6DBD9UL, 0x9D848148UL),
+            ZOBRIST_KEY(0x7034C881UL, 0x22A5793DUL), ZOBRIST_KEY(0x94AA1FD1UL, 0x763563E9UL),
+            ZOBRIST_KEY(0xE85808DFUL, 0xDB2BBBA7UL), ZOBRIST_KEY(0x329D9626UL, 0xABA6BDC3UL),
+            ZOBRIST_KEY(0x548BF679UL, 0xDDF2E2C0UL), ZOBRIST_KEY(0xF50EAED3UL, 0x93D1250DUL),
+            ZOBRIST_KEY(0xBFF34CD1UL, 0x35E3C20BUL), ZOBRIST_KEY(0x277C80F3UL, 0x3399D619UL),
+            ZOBRIST_KEY(0xF22DFFADUL, 0xD24E492AUL), ZOBRIST_KEY(0xEAC88DBBUL, 0x2183CFE9UL),
+            ZOBRIST_KEY(0xE9D39C4BUL, 0x3FE3C53FUL), ZOBRIST_KEY(0x52FC06A3UL, 0x251B3BA5UL),
+            ZOBRIST_KEY(0x5B49853BUL, 0x6DFEC9C4UL), ZOBRIST_KEY(0x57FED40EUL, 0xC63B0078UL),
+            ZOBRIST_KEY(0x47CB1EF4UL, 0xFECC4545UL), ZOBRIST_KEY(0xDF0A2D90UL, 0x10E38968UL),
+            ZOBRIST_KEY(0x42B4BFFAUL, 0x96E4ED01UL), ZOBRIST_KEY(0x6F3371FCUL, 0xCA48470FUL),
+            ZOBRIST_KEY(0x7D4945CDUL, 0x7B0B2504UL), ZOBRIST_KEY(0x215A7B75UL, 0x4C7A6E73UL),
+            ZOBRIST_KEY(0xACCB7268UL, 0x993B6191UL), ZOBRIST_KEY(0x5B65B30BUL, 0xE7CE73D2UL),
+            ZOBRIST_KEY(0x1DA00E7CUL, 0xB35BAA02UL), ZOBRIST_KEY(0xE954E02EUL, 0xD9C54BAAUL),
+            ZOBRIST_KEY(0x708F6EB0UL, 0x23EAA8D4UL), ZOBRIST_KEY(0x9B29B207UL, 0xD157EDF2UL),
+            ZOBRIST_KEY(0x055B322AUL, 0x0E830CA0UL), ZOBRIST_KEY(0x48BC96FEUL, 0x32036E70UL),
+            ZOBRIST_KEY(0x41BBD67AUL, 0xE57719DCUL), ZOBRIST_KEY(0xF35BE87EUL, 0x513BE1EFUL),
+            ZOBRIST_KEY(0xAD64512CUL, 0x8FB74078UL), ZOBRIST_KEY(0x8F14538BUL, 0x2A72AE57UL),
+            ZOBRIST_KEY(0x60DBB042UL, 0x34247668UL), ZOBRIST_KEY(0x41A99C86UL, 0x47E31D2BUL),
+            ZOBRIST_KEY(0x0DA3FAD9UL, 0x6E59D70FUL), ZOBRIST_KEY(0x83834002UL, 0x6062AF3BUL),
+            ZOBRIST_KEY(0x20E23F53UL, 0x693DF264UL), ZOBRIST_KEY(0xF7AFC4C5UL, 0xA0D97CC2UL),
+            ZOBRIST_KEY(0xE123E16BUL, 0x16842948UL), ZOBRIST_KEY(0x701EFA30UL, 0xC1516B12UL),
+            ZOBRIST_KEY(0xB4F31324UL, 0xEA844203UL), ZOBRIST_KEY(0x2985A7F7UL, 0x11FE3D2AUL),
+            ZOBRIST_KEY(0x5D0CD183UL, 0x65781F29UL), ZOBRIST_KEY(0x68D961D3UL, 0x86DA142AUL),
+            ZOBRIST_KEY(0x96AD037EUL, 0x08DD4E83UL), ZOBRIST_KEY(0x3344CBE7UL, 0xC66D78B3UL),
+            ZOBRIST_KEY(0x9CE7DB1AUL, 0xA1D9191BUL), ZOBRIST_KEY(0x0789D7D4UL, 0x72A1D741UL),
+            ZOBRIST_KEY(0x97080AFAUL, 0x0D86E78BUL), ZOBRIST_KEY(0x8BBE5300UL, 0xC301A35EUL)
+        }
+    },
+    {
+        {
+            ZOBRIST_KEY(0xB1273C53UL, 0x23B1468EUL), ZOBRIST_KEY(0x7632F448UL, 0x102CBC92UL),
+            ZOBRIST_KEY(0xE671ABABUL, 0xD8EF6609UL), ZOBRIST_KEY(0x2C429A7BUL, 0x42B25DA8UL),
+            ZOBRIST_KEY(0x20BA7632UL, 0x28DAAB2CUL), ZOBRIST_KEY(0x9B5D1293UL, 0xFFD5333DUL),
+            ZOBRIST_KEY(0x44DA7C38UL, 0xF318C33CUL), ZOBRIST_KEY(0xE0F23BD2UL, 0xF729FE5AUL),
+            ZOBRIST_KEY(0xB453F0F7UL, 0x7869A07FUL), ZOBRIST_KEY(0x449EDB04UL, 0x14ACA630UL),
+            ZOBRIST_KEY(0x8BF71B34UL, 0x98A7D147UL), ZOBRIST_KEY(0x4A8BF9D1UL, 0x16C46171UL),
+            ZOBRIST_KEY(0xEF8EFD53UL, 0x268ED3E4UL), ZOBRIST_KEY(0x9355C51BUL, 0x7DD240C4UL),
+            ZOBRIST_KEY(0x773B3934UL, 0x8A9E4884UL), ZOBRIST_KEY(0xF106311BUL, 0xF0AE9481UL),
+            ZOBRIST_KEY(0xC3220AF5UL, 0x0F1D9E51UL), ZOBRIST_KEY(0x883C1E87UL, 0x509A9155UL),
+            ZOBRIST_KEY(0x2CA8DF9EUL, 0x90D4200DUL), ZOBRIST_KEY(0xC3607C98UL, 0x185E3F6BUL),
+            ZOBRIST_KEY(0x2DB2C17FUL, 0x123E2789UL), ZOBRIST_KEY(0x8DEA7E64UL, 0xB060D80EUL),
+            ZOBRIST_KEY(0x79064E96UL, 0xE1586246UL), ZOBRIST_KEY(0x3337B406UL, 0x7A6E14D1UL),
+            ZOBRIST_KEY(0xBEF8ACCEUL, 0x5DA3D05EUL), ZOBRIST_KEY(0xAF4C92C1UL, 0xB95B98F2UL),
+            ZOBRIST_KEY(0x36373600UL, 0x06886C62UL), ZOBRIST_KEY(0x0E8B477BUL, 0x1F19EF4EUL),
+            ZOBRIST_KEY(0x6C640BDEUL, 0x5DE79113UL), ZOBRIST_KEY(0x676D5D96UL, 0x84B4C891UL),
+            ZOBRIST_KEY(0xB97C0F7DUL, 0xD581DCD7UL), ZOBRIST_KEY(0xA056BF2FUL, 0x5F334F0AUL),
+            ZOBRIST_KEY(0x7B86A434UL, 0x01D2C524UL), ZOBRIST_KEY(0xF64D5E06UL, 0x39AC15F1UL),
+            ZOBRIST_KEY(0x23BE8944UL, 0xE777CE37UL), ZOBRIST_KEY(0x45943115UL, 0x0B6D55B0UL),
+            ZOBRIST_KEY(0xB9DA40C2UL, 0x6DE76061UL), ZOBRIST_KEY(0xCB347028UL, 0x43AABE60UL),
+            ZOBRIST_KEY(0x1915EE40UL, 0x477A0B16UL), ZOBRIST_KEY(0xF3546AD9UL, 0xE0AEC4C2UL),
+            ZOBRIST_KEY(0x9595343AUL, 0x07B330B7UL), ZOBRIST_KEY(0x265F8D44UL, 0x474289CCUL),
+            ZOBRIST_KEY(0x6638F783UL, 0x77FCC7C8UL), ZOBRIST_KEY(0x4D980A92UL, 0x1B9FC08CUL),
+            ZOBRIST_KEY(0xCA73D00AUL, 0x32AF77CEUL), ZOBRIST_KEY(0x57682E65UL, 0xD8B8310DUL),
+            ZOBRIST_KEY(0xC7D9C931UL, 0x7B484F2EUL), ZOBRIST_KEY(0xA547A7DCUL, 0xB4389042UL),
+            ZOBRIST_KEY(0x298AA5B3UL, 0xF9F4DA2FUL), ZOBRIST_KEY(0x3882D641UL, 0xA84DA7AEUL),
+            ZOBRIST_KEY(0x23D0BE56UL, 0xB18CA45BUL), ZOBRIST_KEY(0x3FB9A9A4UL, 0x4704CD7DUL),
+            ZOBRIST_KEY(0x454A26BFUL, 0x573BEC26UL), ZOBRIST_KEY(0xFAC92F28UL, 0x020EBF7FUL),
+            ZOBRIST_KEY(0x06FF8832UL, 0x4447B7E0UL), ZOBRIST_KEY(0x3F01BDDAUL, 0x1E62CC5EUL),
+            ZOBRIST_KEY(0xE258BED9UL, 0xF6ED4A42UL), ZOBRIST_KEY(0x201BE11EUL, 0xEACE8796UL),
+            ZOBRIST_KEY(0x9B5DDC76UL, 0x7FB9F4A7UL), ZOBRIST_KEY(0xD665EFC0UL, 0x3014D46EUL),
+            ZOBRIST_KEY(0x0F395254UL, 0x0F0CEB8EUL), ZOBRIST_KEY(0xF388264CUL, 0x9FEA68D0UL),
+            ZOBRIST_KEY(0xC501CE11UL, 0x7C7DB405UL), ZOBRIST_KEY(0x17BFF2B8UL, 0x6CF41430UL)
+        },
+        {
+            ZOBRIST_KEY(0xC7B1F7E3UL, 0x61C2C9BDUL), ZOBRIST_KEY(0x6EC204A5UL, 0xDAD94F0AUL),
+            ZOBRIST_KEY(0xA59BF96CUL, 0x7B9B8F07UL), ZOBRIST_KEY(0x17498DDBUL, 0x178AC042UL),
+            ZOBRIST_KEY(0xE2AA79F5UL, 0x86059B9CUL), ZOBRIST_KEY(0x5196EA2CUL, 0xF22B172DUL),
+            ZOBRIST_KEY(0x7F56480AUL, 0xAE072FEBUL), ZOBRIST_KEY(0x643053B9UL, 0x18EAD4A9UL),
+            ZOBRIST_KEY(0x10E15A1AUL, 0x0D5C302BUL), ZOBRIST_KEY(0xDD617483UL, 0x0E2B1502UL),
+            ZOBRIST_KEY(0xAFDC30BAUL, 0x94BE97E0UL), ZOBRIST_KEY(0xE06485A3UL, 0x7C7DA3D2UL),
+            ZOBRIST_KEY(0x4C2D2EF8UL, 0x0E664CB6UL), ZOBRIST_KEY(0xD55E6AF2UL, 0x0A168BB0UL),
+            ZOBRIST_KEY(0x48C10868UL, 0x2AC5B2C9UL), ZOBRIST_KEY(0xCCC52448UL, 0x8CFD5775UL),
+            ZOBRIST_KEY(0xD11D0118UL, 0x61C6F085UL), ZOBRIST_KEY(0x3A69FFC1UL, 0x45086613UL),
+            ZOBRIST_KEY(0xFB14CA84UL, 0xC35D3A21UL), ZOBRIST_KEY(0x9132A60AUL, 0xECBC6B5AUL),
+            ZOBRIST_KEY(0xB79A1579UL, 0x74048994UL), ZOBRIST_KEY(0x30F01298UL, 0x119F69BFUL),
+            ZOBRIST_KEY(0xEC46A268UL, 0x22DEB468UL), ZOBRIST_KEY(0x7FD721DBUL, 0xF73712F5UL),
+            ZOBRIST_KEY(0x67035C6AUL, 0x26F050D4UL), ZOBRIST_KEY(0xC0C76C39UL, 0xFB85A70BUL),
+            ZOBRIST_KEY(0xAFEEB62AUL, 0x65A72347UL), ZOBRIST_KEY(0x5C7A974FUL, 0xA575D2B0UL),
+            ZOBRIST_KEY(0x6EA1F828UL, 0x19290D04UL), ZOBRIST_KEY(0x21550B39UL, 0x7B0A6E9AUL),
+            ZOBRIST_KEY(0x7830FD1EUL, 0x62961110UL), ZOBRIST_KEY(0xFAFA1C21UL, 0x64B1134DUL),
+            ZOBRIST_KEY(0x0B3281A5UL, 0x7E41D946UL), ZOBRIST_KEY(0xFBBEA631UL, 0xCAD626AFUL),
+            ZOBRIST_KEY(0xAD934F23UL, 0xDDF98CCCUL), ZOBRIST_KEY(0xB704243FUL, 0xA1A3B5CDUL),
+            ZOBRIST_KEY(0x80B79E65UL, 0x6A18A692UL), ZOBRIST_KEY(0x8C3DABF8UL, 0x715A2C61UL),
+            ZOBRIST_KEY(0xEF4CB74FUL, 0x7B167367UL), ZOBRIST_KEY(0x42793257UL, 0xAE1D061FUL),
+            ZOBRIST_KEY(0x99168733UL, 0x128F7485UL), ZOBRIST_KEY(0xF368DB87UL, 0x43355243UL),
+            ZOBRIST_KEY(0x041F18A2UL, 0x67C4CD0AUL), ZOBRIST_KEY(0xB225D7D0UL, 0x66D341F8UL),
+            ZOBRIST_KEY(0xA9BE4E08UL, 0xEFDC4949UL), ZOBRIST_KEY(0xB8827504UL, 0x8B7DF31FUL),
+            ZOBRIST_KEY(0x205B2604UL, 0xC7C82206UL), ZOBRIST_KEY(0x79D66426UL, 0x4B3EB707UL),
+            ZOBRIST_KEY(0x3F2AF8DBUL, 0x0B3CAE37UL), ZOBRIST_KEY(0x47E5B5C7UL, 0xFC24782CUL),
+            ZOBRIST_KEY(0x93770515UL, 0xD0EE3A44UL), ZOBRIST_KEY(0x060364A7UL, 0x9B6B843DUL),
+            ZOBRIST_KEY(0x23AD0CE9UL, 0xBD2C0EBFUL), ZOBRIST_KEY(0x0A1FF12EUL, 0x8E00FE99UL),
+            ZOBRIST_KEY(0xC962364FUL, 0x76E7EC12UL), ZOBRIST_KEY(0xEDC26ED8UL, 0x4B935048UL),
+            ZOBRIST_KEY(0xD3EB0EE2UL, 0xD194B62FUL), ZOBRIST_KEY(0xCEE736A0UL, 0xD1F6F9DEUL),
+            ZOBRIST_KEY(0x0FC3645FUL, 0x293D9759UL), ZOBRIST_KEY(0xCCE0FD3AUL, 0xA9BC4FCCUL),
+            ZOBRIST_KEY(0x5AC6C3FFUL, 0x498239FCUL), ZOBRIST_KEY(0x521BC696UL, 0x7270E756UL),
+            ZOBRIST_KEY(0x5927DB2CUL, 0x7CE9CB99UL), ZOBRIST_KEY(0xE8F9E287UL, 0xEA8BEA4BUL)
+        },
+        {
+            ZOBRIST_KEY(0xFAE32444UL, 0x503AF4F0UL), ZOBRIST_KEY(0x97E0D3B6UL, 0x4669D2B0UL),
+            ZOBRIST_KEY(0x6301F463UL, 0x4F0A70E2UL), ZOBRIST_KEY(0x6F1D3287UL, 0x00D11163UL),
+            ZOBRIST_KEY(0x1C82935AUL, 0xC04BD0A6UL), ZOBRIST_KEY(0x9F79B9F6UL, 0x6CE0ACB9UL),
+            ZOBRIST_KEY(0xF6661A66UL, 0xF3FE7BEFUL), ZOBRIST_KEY(0x517B1CB0UL, 0x327AABE6UL),
+            ZOBRIST_KEY(0x8E98BDE9UL, 0x37CCDB6CUL), ZOBRIST_KEY(0x346B337CUL, 0xD95AD241UL),
+            ZOBRIST_KEY(0xF96F9902UL, 0xF9897045UL), ZOBRIST_KEY(0x11632483UL, 0x10CC90CDUL),
+            ZOBRIST_KEY(0x60D4FF8DUL, 0x6346D781UL), ZOBRIST_KEY(0xFCFCF6EDUL, 0x8C22EEEBUL),
+            ZOBRIST_KEY(0xFC1345AAUL, 0x59E9C81BUL), ZOBRIST_KEY(0xBED243A1UL, 0xA5873A21UL),
+            ZOBRIST_KEY(0x90627DB8UL, 0x57748C96UL), ZOBRIST_KEY(0x589D2BFAUL, 0xA08E16ABUL),
+            ZOBRIST_KEY(0x033C5010UL, 0x45030DB4UL), ZOBRIST_KEY(0x686D3360UL, 0xFF1C78FBUL),
+            ZOBRIST_KEY(0xF25A4FB3UL, 0x9A1C5FDDUL), ZOBRIST_KEY(0xF70CAAB1UL, 0x650A7A93UL),
+            ZOBRIST_KEY(0x422C3AF3UL, 0xEC788023UL), ZOBRIST_KEY(0xFE0626CEUL, 0xA3FFC388UL),
+            ZOBRIST_KEY(0x31E5F242UL, 0x1318D8B1UL), ZOBRIST_KEY(0x40FE45F5UL, 0x7432188BUL),
+            ZOBRIST_KEY(0x731BCBC7UL, 0x4D12A33AUL), ZOBRIST_KEY(0xAE67AC37UL, 0x99B2F512UL),
+            ZOBRIST_KEY(0xB9CB299DUL, 0x32EF24A4UL), ZOBRIST_KEY(0xDF223AB3UL, 0xFC0D026AUL),
+            ZOBRIST_KEY(0x7F123ADAUL, 0x3B06124CUL), ZOBRIST_KEY(0x12F367EBUL, 0x37CA1996UL),
+            ZOBRIST_KEY(0xC47E2063UL, 0x687BE2FDUL), ZOBRIST_KEY(0xE2882630UL, 0x6341CAEAUL),
+            ZOBRIST_KEY(0x64C87EBDUL, 0x860A9840UL), ZOBRIST_KEY(0x04FA8BCCUL, 0xD1867A24UL),
+            ZOBRIST_KEY(0x04EA546BUL, 0x030F02FEUL), ZOBRIST_KEY(0xA7C034E9UL, 0x4DF9BF3CUL),
+            ZOBRIST_KEY(0x1A9241C1UL, 0xE6896059UL), ZOBRIST_KEY(0x3D5E0BB2UL, 0xD38ECA2CUL),
+            ZOBRIST_KEY(0x16C0ED3EUL, 0xF1293119UL), ZOBRIST_KEY(0x55D96E1DUL, 0x1364F17AUL),
+            ZOBRIST_KEY(0x838D0BD1UL, 0x1C4524AAUL), ZOBRIST_KEY(0x469F3CE5UL, 0x9A51840CUL),
+            ZOBRIST_KEY(0x8C5A024CUL, 0x3390D74DUL), ZOBRIST_KEY(0x7492B65DUL, 0x8E7E017EUL),
+            ZOBRIST_KEY(0x54575DDBUL, 0x1A37BDB0UL), ZOBRIST_KEY(0x613E3182UL, 0xC3E8CC2AUL),
+            ZOBRIST_KEY(0x1F2E5E97UL, 0x752DCAE7UL), ZOBRIST_KEY(0x43CF7CBDUL, 0x811C831AUL),
+            ZOBRIST_KEY(0x857D275CUL, 0x567411D8UL), ZOBRIST_KEY(0xA5CFC2E3UL, 0xA8DBA2EEUL),
+            ZOBRIST_KEY(0xE1572D4DUL, 0xB5CB2100UL), ZOBRIST_KEY(0xF60961E3UL, 0x222AB1D1UL),
+            ZOBRIST_KEY(0xDA045CD6UL, 0x12363E15UL), ZOBRIST_KEY(0x19E663DFUL, 0xD30C6064UL),
+            ZOBRIST_KEY(0x9C42D54EUL, 0x0E774D78UL), ZOBRIST_KEY(0x9D1A3287UL, 0x3B7B57D7UL),
+            ZOBRIST_KEY(0xF3E54F2AUL, 0x6B03D782UL), ZOBRIST_KEY(0x3A2C233AUL, 0xC71C5C07UL),
+            ZOBRIST_KEY(0x269E00ECUL, 0xA2D3B96DUL), ZOBRIST_KEY(0xAB3F1692UL, 0xE9366600UL),
+            ZOBRIST_KEY(0x65DB1308UL, 0xF98745A7UL), ZOBRIST_KEY(0x8B635E78UL, 0x6186CAB4UL)
+        },
+        {
+            ZOBRIST_KEY(0x636A3F5CUL, 0x2DDB2702UL), ZOBRIST_KEY(0xAC6829B6UL, 0xB8E8CAE2UL),
+            ZOBRIST_KEY(0x45343325UL, 0x30B3FFA2UL), ZOBRIST_KEY(0x115258E6UL, 0xC9FE69ABUL),
+            ZOBRIST_KEY(0x11F1D3C1UL, 0xF0B39F00UL), ZOBRIST_KEY(0xE9F700EBUL, 0xD74BA508UL),
+            ZOBRIST_KEY(0x9AD5D2ECUL, 0xA55F10F4UL), ZOBRIST_KEY(0x54D66BFDUL, 0xE0B44C90UL),
+            ZOBRIST_KEY(0x3648A093UL, 0xE57D29B4UL), ZOBRIST_KEY(0x22329F6DUL, 0x18755C87UL),
+            ZOBRIST_KEY(0xBEE5ABCFUL, 0xF262BB37UL), ZOBRIST_KEY(0xEF0A9070UL, 0x1FE9880DUL),
+            ZOBRIST_KEY(0xA70C8DD7UL, 0x6E6775BDUL), ZOBRIST_KEY(0xC1C229C3UL, 0x2EBCA393UL),
+            ZOBRIST_KEY(0xC85A269BUL, 0x9E561478UL), ZOBRIST_KEY(0x28BF9D94UL, 0x2863EE72UL),
+            ZOBRIST_KEY(0xC929FF5FUL, 0xA82A6B37UL), ZOBRIST_KEY(0x2CF38514UL, 0x1E230A36UL),
+            ZOBRIST_KEY(0xBBFBCE84UL, 0x7ADE37C3UL), ZOBRIST_KEY(0x1561520FUL, 0xC45C6DEBUL),
+            ZOBRIST_KEY(0x0A5C7203UL, 0x4B2C39FFUL), ZOBRIST_KEY(0x7846A9B3UL, 0x2A2BAD17UL),
+            ZOBRIST_KEY(0xCA265361UL, 0xC99A1F17UL), ZOBRIST_KEY(0x68AF08EBUL, 0x0284A79FUL),
+            ZOBRIST_KEY(0x623ECB0AUL, 0xAE05A131UL), ZOBRIST_KEY(0xD4F42221UL, 0x9AA70BD2UL),
+            ZOBRIST_KEY(0x1E763C7AUL, 0x34E7B8E0UL), ZOBRIST_KEY(0x3EE386BEUL, 0x56045609UL),
+            ZOBRIST_KEY(0x1569C683UL, 0x2AA6EEFBUL), ZOBRIST_KEY(0x4E817A9AUL, 0xEA1AE58EUL),
+            ZOBRIST_KEY(0xE2BD1AE4UL, 0x4DEB9174UL), ZOBRIST_KEY(0x86135B81UL, 0xBF17A7A4UL),
+            ZOBRIST_KEY(0x066B4076UL, 0xAAAEDFA5UL), ZOBRIST_KEY(0x50B8921FUL, 0x350FB0F5UL),
+            ZOBRIST_KEY(0xB045F2DBUL, 0x95D4F5E2UL), ZOBRIST_KEY(0x2EA50851UL, 0x69D24C0EUL),
+            ZOBRIST_KEY(0x40D61F8FUL, 0x7E6EDC99UL), ZOBRIST_KEY(0x5C5F409CUL, 0x1C39558CUL),
+            ZOBRIST_KEY(0xBA5EF8BEUL, 0x3368C16EUL), ZOBRIST_KEY(0xAEEDB297UL, 0x3653FA25UL),
+            ZOBRIST_KEY(0x00D1C618UL, 0x81391BAAUL), ZOBRIST_KEY(0xD4D6D90CUL, 0xE5E22B59UL),
+            ZOBRIST_KEY(0x10D82B08UL, 0xF3DDBADAUL), ZOBRIST_KEY(0x9043DFFDUL, 0x91D52CA4UL),
+            ZOBRIST_KEY(0x808E3338UL, 0x884464B2UL), ZOBRIST_KEY(0x9947A784UL, 0x7AB900FBUL),
+            ZOBRIST_KEY(0x389BA77EUL, 0xAAEC8731UL), ZOBRIST_KEY(0x1237EEEEUL, 0x92BE7717UL),
+            ZOBRIST_KEY(0xA6A28B51UL, 0x65B92692UL), ZOBRIST_KEY(0x95EC1DD7UL, 0xD03C3998UL),
+            ZOBRIST_KEY(0x0DF95700UL, 0xEA8BC6E0UL), ZOBRIST_KEY(0x42491C09UL, 0xD5CE138FUL),
+            ZOBRIST_KEY(0xB81B4929UL, 0xA85A98E3UL), ZOBRIST_KEY(0xE12936AAUL, 0x55C31592UL),
+            ZOBRIST_KEY(0xAF2B5E51UL, 0xBB3564D8UL), ZOBRIST_KEY(0xB1C69296UL, 0xBD15C2F5UL),
+            ZOBRIST_KEY(0xAF11A2AFUL, 0x9E076A09UL), ZOBRIST_KEY(0x23DE4402UL, 0xC2F0E9D4UL),
+            ZOBRIST_KEY(0xC136987FUL, 0xD8BE5D26UL), ZOBRIST_KEY(0x6A63ABD8UL, 0x29E05E19UL),
+            ZOBRIST_KEY(0xD9DD1CA1UL, 0xED779C6BUL), ZOBRIST_KEY(0x80153698UL, 0xE7B64276UL),
+            ZOBRIST_KEY(0xC0C571F4UL, 0xF74EBFF7UL), ZOBRIST_KEY(0x7B2A38F4UL, 0xC4ED81F9UL)
+        },
+        {
+            ZOBRIST_KEY(0x5145AC2AUL, 0x241E1B63UL), ZOBRIST_KEY(0x25A64E02UL, 0x3973DAE8UL),
+            ZOBRIST_KEY(0x02274BB7UL, 0x014ECBD4UL), ZOBRIST_KEY(0x471C089EUL, 0xB2A36D85UL),
+            ZOBRIST_KEY(0xB37CBC9CUL, 0xEA267214UL), ZOBRIST_KEY(0xCE93825AUL, 0xA8EDF895UL),
+            ZOBRIST_KEY(0xC4C2F33BUL, 0xAFB20BA3UL), ZOBRIST_KEY(0xAE7C98A4UL, 0x4A591722UL),
+            ZOBRIST_KEY(0x747E8226UL, 0x2D160512UL), ZOBRIST_KEY(0xE769AE6EUL, 0xD292F75FUL),
+            ZOBRIST_KEY(0x63CCC73AUL, 0xFF8A8239UL), ZOBRIST_KEY(0x2462B90FUL, 0x437393D8UL),
+            ZOBRIST_KEY(0x1726D1ADUL, 0xAAF0929BUL), ZOBRIST_KEY(0x014C88ACUL, 0x042F0212UL),
+            ZOBRIST_KEY(0xE51B3CC9UL, 0x48D10A39UL), ZOBRIST_KEY(0x67518870UL, 0x41621618UL),
+            ZOBRIST_KEY(0xA3496E2EUL, 0xBF96DABFUL), ZOBRIST_KEY(0xA77BD79EUL, 0x09C8953EUL),
+            ZOBRIST_KEY(0x75CC4C0EUL, 0x3E552275UL), ZOBRIST_KEY(0xB7E2D511UL, 0x5CC0DFEDUL),
+            ZOBRIST_KEY(0x395C80BBUL, 0x439DEF8AUL), ZOBRIST_KEY(0xDFC89A04UL, 0x62B9E54EUL),
+            ZOBRIST_KEY(0x96C5C1E7UL, 0x45820B84UL), ZOBRIST_KEY(0x0517829EUL, 0x8FEADEC3UL),
+            ZOBRIST_KEY(0x6EFAACD5UL, 0x7F5352B8UL), ZOBRIST_KEY(0x93837CD5UL, 0x85804A59UL),
+            ZOBRIST_KEY(0x484C1516UL, 0x9BA8B475UL), ZOBRIST_KEY(0x71F8CF43UL, 0xD35D6C9AUL),
+            ZOBRIST_KEY(0xA2BA445BUL, 0x5036981EUL), ZOBRIST_KEY(0xE386AF8DUL, 0x70B435B7UL),
+            ZOBRIST_KEY(0x9A60804CUL, 0x4F97B6F9UL), ZOBRIST_KEY(0x1B506BBBUL, 0x64F3A64AUL),
+            ZOBRIST_KEY(0xC3F91E8EUL, 0xC812A1F4UL), ZOBRIST_KEY(0x1D262B34UL, 0x3D569705UL),
+            ZOBRIST_KEY(0x882C9793UL, 0x6A7DCE10UL), ZOBRIST_KEY(0x93E20049UL, 0xEEB7B380UL),
+            ZOBRIST_KEY(0xCAAB3156UL, 0x6754D753UL), ZOBRIST_KEY(0x37DB2CC0UL, 0x7730215AUL),
+            ZOBRIST_KEY(0xA27D19F4UL, 0x7EE36873UL), ZOBRIST_KEY(0x1102D3C7UL, 0x6F242299UL),
+            ZOBRIST_KEY(0x491C75C5UL, 0x82FFF989UL), ZOBRIST_KEY(0x6B86DEF9UL, 0xD8C69DE8UL),
+            ZOBRIST_KEY(0x2838E900UL, 0x33C04F70UL), ZOBRIST_KEY(0x01E59041UL, 0x6A6660DDUL),
+            ZOBRIST_KEY(0x2EA8C7BEUL, 0x8A1D79F8UL), ZOBRIST_KEY(0xD68B82B9UL, 0x764DD802UL),
+            ZOBRIST_KEY(0x8170027DUL, 0x4C9C884BUL), ZOBRIST_KEY(0x7B6A538CUL, 0xDBD62630UL),
+            ZOBRIST_KEY(0x88D6100BUL, 0x0DCA8908UL), ZOBRIST_KEY(0x6B506467UL, 0xBCCF7DFAUL),
+            ZOBRIST_KEY(0xC976FE0BUL, 0x6F8232C0UL), ZOBRIST_KEY(0x6613AEBFUL, 0xAEA438B6UL),
+            ZOBRIST_KEY(0x9CDCE7ABUL, 0xBB2DBCD4UL), ZOBRIST_KEY(0x233D8462UL, 0xECD507B3UL),
+            ZOBRIST_KEY(0x11E8FBA5UL, 0x47720F92UL), ZOBRIST_KEY(0xFB515787UL, 0x0B7E5FE4UL),
+            ZOBRIST_KEY(0xF5DBBA28UL, 0xEC91B474UL), ZOBRIST_KEY(0x9CE245E6UL, 0x6375094FUL),
+            ZOBRIST_KEY(0xBB232CD5UL, 0x1CE0F0CDUL), ZOBRIST_KEY(0xE244A45EUL, 0x0937D1C5UL),
+            ZOBRIST_KEY(0x2C0BEDDCUL, 0xDA12049DUL), ZOBRIST_KEY(0x54BBF5B4UL, 0x0B2E71F7UL),
+            ZOBRIST_KEY(0x2B79227DUL, 0x664D2521UL), ZOBRIST_KEY(0x05DD0D53UL, 0xE1672796UL)
+        },
+        {
+            ZOBRIST_KEY(0x76B22711UL, 0x7311EA9CUL), ZOBRIST_KEY(0x379BCBD6UL, 0xB5E458F2UL),
+            ZOBRIST_KEY(0x9B47106DUL, 0xE6B7B2BDUL), ZOBRIST_KEY(0x0FE24BBBUL, 0x69A7EF9DUL),
+            ZOBRIST_KEY(0x97863B52UL, 0x41EEA919UL), ZOBRIST_KEY(0xE85464C1UL, 0x612915FDUL),
+            ZOBRIST_KEY(0xF8249630UL, 0x7A64FA58UL), ZOBRIST_KEY(0x398A8E54UL, 0x7A46F247UL),
+            ZOBRIST_KEY(0xD55DE414UL, 0x41CC177FUL), ZOBRIST_KEY(0x05F4EF8FUL, 0xEBE534C4UL),
+            ZOBRIST_KEY(0xCB414683UL, 0x41AE5847UL), ZOBRIST_KEY(0xAE67FB66UL, 0x0BE3DE77UL),
+            ZOBRIST_KEY(0x5CDC8E5CUL, 0x44F8D827UL), ZOBRIST_KEY(0xF0F1E491UL, 0xD9A83041UL),
+            ZOBRIST_KEY(0x9B892C9BUL, 0x121BA725UL), ZOBRIST_KEY(0xC8AC0B43UL, 0x6D6C99DFUL),
+            ZOBRIST_KEY(0xC782198BUL, 0xFC1CDE0CUL), ZOBRIST_KEY(0xBBB2E67BUL, 0x55646107UL),
+            ZOBRIST_KEY(0x9B0E16C7UL, 0xE386A4CFUL), ZOBRIST_KEY(0x99D87676UL, 0xE6B53F17UL),
+            ZOBRIST_KEY(0x6CCE9A80UL, 0x46BDB1DFUL), ZOBRIST_KEY(0xC3547929UL, 0x6DF4F2A5UL),
+            ZOBRIST_KEY(0x1FD87909UL, 0x0C28B5DAUL), ZOBRIST_KEY(0x975C5FD3UL, 0xBA57B6ADUL),
+            ZOBRIST_KEY(0x562BCE15UL, 0xF6C79B90UL), ZOBRIST_KEY(0xBEBA7621UL, 0x7486A397UL),
+            ZOBRIST_KEY(0xA0474D9CUL, 0xEAAF0561UL), ZOBRIST_KEY(0xA1D5A800UL, 0xAF172879UL),
+            ZOBRIST_KEY(0x32B48153UL, 0x9E7C93A5UL), ZOBRIST_KEY(0xA1918FA6UL, 0x707277E2UL),
+            ZOBRIST_KEY(0x6C5E8CE1UL, 0x4B6A1672UL), ZOBRIST_KEY(0x2F3B5F0EUL, 0x8E5D6B29UL),
+            ZOBRIST_KEY(0x1AF6D1D2UL, 0x53394B4BUL), ZOBRIST_KEY(0x73BE96C2UL, 0xB50AC1B8UL),
+            ZOBRIST_KEY(0x13A1AD76UL, 0x38CCE512UL), ZOBRIST_KEY(0xCC794379UL, 0x07D466B8UL),
+            ZOBRIST_KEY(0x0294AD89UL, 0x012E81CFUL), ZOBRIST_KEY(0xA3B7C9CDUL, 0x6FBC84CBUL),
+            ZOBRIST_KEY(0x2317A8A9UL, 0x6C9C2858UL), ZOBRIST_KEY(0xFAFE96F2UL, 0xF5FD0229UL),
+            ZOBRIST_KEY(0x2D37946AUL, 0x18709D28UL), ZOBRIST_KEY(0xF972FA25UL, 0x42559544UL),
+            ZOBRIST_KEY(0x47A394FEUL, 0x0BF8491EUL), ZOBRIST_KEY(0x019BCD88UL, 0x551D8345UL),
+            ZOBRIST_KEY(0x12D02ABEUL, 0x94907739UL), ZOBRIST_KEY(0x23A50F68UL, 0x54DAAB56UL),
+            ZOBRIST_KEY(0xAAA0AE47UL, 0xFAAC6C61UL), ZOBRIST_KEY(0xB0FFF5ECUL, 0xCE2E84B9UL),
+            ZOBRIST_KEY(0xD23AAC7DUL, 0xC96E7BD0UL), ZOBRIST_KEY(0x985363B3UL, 0xDC0ECD25UL),
+            ZOBRIST_KEY(0xD65DB49DUL, 0x7D512A86UL), ZOBRIST_KEY(0x946DCEF0UL, 0xC3314668UL),
+            ZOBRIST_KEY(0x835414F5UL, 0x70CD7013UL), ZOBRIST_KEY(0x112FAF41UL, 0xDF0937BAUL),
+            ZOBRIST_KEY(0xD43A1E42UL, 0x5588957AUL), ZOBRIST_KEY(0xC5C71C80UL, 0x7D6D5004UL),
+            ZOBRIST_KEY(0xEFE9E762UL, 0xC9293AA5UL), ZOBRIST_KEY(0x8B1F6B26UL, 0x4D037E97UL),
+            ZOBRIST_KEY(0x08C828B3UL, 0x66CFD450UL), ZOBRIST_KEY(0x0DB75760UL, 0x9748EA77UL),
+            ZOBRIST_KEY(0xDF573F99UL, 0x0412F26DUL), ZOBRIST_KEY(0xFFA54AB8UL, 0xA68EB6C6UL),
+            ZOBRIST_KEY(0x64C4ADC2UL, 0x934ACA74UL), ZOBRIST_KEY(0xCE90EBCDUL, 0xB0EC5D08UL)
+        }
+    }
+};
+
+const zobrist_t zobrist_castling[16] = {
+    ZOBRIST_KEY(0x6D33365AUL, 0x1E643975UL), ZOBRIST_KEY(0xDFD4E8E0UL, 0x540EC74DUL),
+    ZOBRIST_KEY(0x20F8AD0AUL, 0x2E1A7F7AUL), ZOBRIST_KEY(0x5A377BDEUL, 0xB0A78237UL),
+    ZOBRIST_KEY(0x5BDD5CD6UL, 0x2B1CF709UL), ZOBRIST_KEY(0x8925EFBCUL, 0xEB5F8FDAUL),
+    ZOBRIST_KEY(0xC4D1EA78UL, 0xB625FF96UL), ZOBRIST_KEY(0x67DDBC6EUL, 0xF9772E74UL),
+    ZOBRIST_KEY(0x69AF01A6UL, 0x177D2EC0UL), ZOBRIST_KEY(0xCE87FEB2UL, 0x8009B9E4UL),
+    ZOBRIST_KEY(0x2263E97DUL, 0x7BCD5FF8UL), ZOBRIST_KEY(0x3F986355UL, 0xD3DD3EE0UL),
+    ZOBRIST_KEY(0x12DF4B1EUL, 0x2B2D5B98UL), ZOBRIST_KEY(0xCB30FD89UL, 0xFBBA7677UL),
+    ZOBRIST_KEY(0x8F9EBA42UL, 0x6EC5D253UL), ZOBRIST_KEY(0x2CCBCAE5UL, 0x630FB359UL)
+};
+
+const zobrist_t zobrist_en_passant[8] = {
+    ZOBRIST_KEY(0x2E3626BEUL, 0xEEE5FBDBUL), ZOBRIST_KEY(0xBFDBA008UL, 0xDA4B4126UL),
+    ZOBRIST_KEY(0x803E52E1UL, 0xAC2D388DUL), ZOBRIST_KEY(0x3BE926F1UL, 0xC6F4F7B4UL),
+    ZOBRIST_KEY(0x102443F9UL, 0x02554455UL), ZOBRIST_KEY(0xABAE57DAUL, 0xBEE6DCE0UL),
+    ZOBRIST_KEY(0xEC0A8DC8UL, 0x92F0070AUL), ZOBRIST_KEY(0x56544A13UL, 0x56554BACUL)
+};
+
+const zobrist_t zobrist_side =
+    ZOBRIST_KEY(0x8907B050UL, 0x1F3ADDB8UL);
@@ -0,0 +1,71 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Constant lookup tables for the move generators, the evaluation and the
+ * position hash, generated into chess_tables.c by tools/gen_chess_tables.c.
+ * Being const, they are kept in flash and cost no RAM.
+ */
+#ifndef CHESS_TABLES
+#define CHESS_TABLES
+
+#include <chess_functions.h>
+
+/*
+ * Terminates the target lists below.
+ */
+#ifndef NO_SQUARE
+#define NO_SQUARE 0xFF
+#endif
+
+/*
+ * Square offset of one step in each direction. Directions 0-3 are the rook
+ * directions (+x, -x, +y, -y), directions 4-7 the bishop directions
+ * (+x+y, +x-y, -x+y, -x-y), so a white pawn captures along 4 and 5 and a
+ * black pawn along 6 and 7.
+ */
+extern const signed char direction_offset[8];
+
+/*
+ * Number of squares between each square and the edge of the board in each
+ * direction. Walking a ray is direction_offset[dir] added ray_length times,
+ * with no bounds tests needed.
+ */
+extern const unsigned char ray_length[64][8];
+
+/*
+ * Squares a knight or king on each square attacks, terminated by NO_SQUARE.
+ */
+extern const unsigned char knight_targets[64][9];
+extern const unsigned char king_targets[64][9];
+
+/*
+ * Piece value plus square bonus in centipawns, for the midgame and the
+ * endgame, indexed by piece type - 1 and square. The tables are laid out
+ * for white; black looks up the square mirrored onto white's side.
+ */
+extern const short pst_midgame[6][64];
+extern const short pst_endgame[6][64];
+
+#define PST_SQUARE(piece, square) (PIECE_SIDE(piece) ? (square) ^ 0x38 : (square))
+
+/*
+ * Zobrist keys. The generator writes every key as two 32-bit halves, and
+ * the MSP430 build keeps only the low one.
+ */
+#ifdef __MSP430__
+#define ZOBRIST_KEY(high, low) ((zobrist_t) (low))
+#else
+#define ZOBRIST_KEY(high, low) (((zobrist_t) (high) << 32) | (low))
+#endif
+
+extern const zobrist_t zobrist_pieces[2][6][64];
+extern const zobrist_t zobrist_castling[16];    /* by CASTLE_* bits */
+extern const zobrist_t zobrist_en_passant[8];   /* by column of the square */
+extern const zobrist_t zobrist_side;            /* black to move */
+
+#define ZOBRIST_PIECE(piece, square) \
+    (zobrist_pieces[PIECE_SIDE(piece)][PIECE_TYPE(piece) - 1][square])
+
+#endif /* CHESS_TABLES */
@@ -0,0 +1,78 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Transposition table: what the search found out about positions it has
+ * already seen, looked up by position hash.
+ */
+#include <chess_functions.h>
+#include <chess_ttable.h>
+
+/*
+ * Entry 0 of each bucket is kept for the deepest search, entry 1 always
+ * takes the latest.
+ */
+static tt_entry_t table[TT_BUCKETS][2];
+
+/* Age of the search in progress, kept in the top six bits of the flags */
+static unsigned char age = 0;
+
+#define TT_BUCKET(hash) (table[(hash) & (TT_BUCKETS - 1)])
+#define TT_AGE(entry) ((entry)->flags & 0xFC)
+
+/**
+ * Empties the table.
+ */
+void tt_clear() {
+    unsigned long i;
+
+    for (i = 0; i < TT_BUCKETS; i++) {
+        table[i][0].flags = 0;
+        table[i][1].flags = 0;
+    }
+}
+
+/**
+ * Starts a new search. Entries of older searches are replaced first.
+ */
+void tt_new_search() {
+    age += 4;
+}
+
+/**
+ * Looks the position up by its hash.
+ *
+ * Returns: the entry stored for it, or 0 if there is none
+ */
+const tt_entry_t *tt_probe(zobrist_t hash) {
+    tt_entry_t *bucket = TT_BUCKET(hash);
+    tt_key_t key = TT_KEY(hash);
+
+    if (TT_BOUND(&bucket[0]) && bucket[0].key == key) return &bucket[0];
+    if (TT_BOUND(&bucket[1]) && bucket[1].key == key) return &bucket[1];
+    return 0;
+}
+
+/**
+ * Stores what a search of the given depth found out about a position.
+ */
+void tt_store(zobrist_t hash, move_t move, int depth, int bound, int score) {
+    tt_entry_t *bucket = TT_BUCKET(hash);
+    tt_entry_t *entry = &bucket[1];
+    tt_key_t key = TT_KEY(hash);
+
+    // the deep slot only gives way to a search at least as deep, or to any
+    // search once its own is over
+    if (!TT_BOUND(&bucket[0]) || bucket[0].key == key ||
+            TT_AGE(&bucket[0]) != age || depth >= bucket[0].depth) {
+        entry = &bucket[0];
+    }
+
+    // an entry without a move keeps the one found before
+    if (move || entry->key != key) entry->move = move;
+    entry->key = key;
+    entry->score = score;
+    entry->depth = depth;
+    entry->flags = age | bound;
+}
@@ -0,0 +1,84 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for the transposition table: what the search found out about
+ * positions it has already seen, looked up by position hash.
+ */
+#ifndef CHESS_TTABLE
+#define CHESS_TTABLE
+
+#include <chess_functions.h>
+
+/*
+ * Number of buckets, a power of two, fixed at compile time. Each bucket
+ * holds two entries: one kept for the deepest search of the positions that
+ * land there, one that always takes the latest. An entry takes 16 bytes on
+ * a 64-bit host, so the default 2^17 buckets take 4 MB. Define TT_BUCKETS
+ * to change it.
+ *
+ * The MSP430 keeps only the top 16 bits of the hash as the key, the bottom
+ * ones picking the bucket, so an entry takes 8 bytes there, and the default
+ * 2 buckets take the 32 bytes the search leaves free (see chess_search.h).
+ */
+#ifndef TT_BUCKETS
+#ifdef __MSP430__
+#define TT_BUCKETS 2
+#else
+#define TT_BUCKETS (1UL << 17)
+#endif
+#endif
+
+/*
+ * The part of the hash an entry keeps to tell the positions of its bucket
+ * apart.
+ */
+#ifdef __MSP430__
+typedef unsigned short tt_key_t;
+#define TT_KEY(hash) ((tt_key_t) ((hash) >> 16))
+#else
+typedef zobrist_t tt_key_t;
+#define TT_KEY(hash) (hash)
+#endif
+
+/*
+ * How the stored score relates to the true one.
+ */
+#define TT_EXACT 1  /* it is the score */
+#define TT_LOWER 2  /* the search cut off, the score is at least this */
+#define TT_UPPER 3  /* no move beat alpha, the score is at most this */
+
+typedef struct {
+    tt_key_t key;
+    move_t move;           /* best move found, 0 if none */
+    short score;
+    unsigned char depth;
+    unsigned char flags;   /* TT_* bound in bits 0-1, search age above */
+} tt_entry_t;
+
+#define TT_BOUND(entry) ((entry)->flags & 0x03)
+
+/**
+ * Empties the table.
+ */
+void tt_clear();
+
+/**
+ * Starts a new search. Entries of older searches are replaced first.
+ */
+void tt_new_search();
+
+/**
+ * Looks the position up by its hash.
+ *
+ * Returns: the entry stored for it, or 0 if there is none
+ */
+const tt_entry_t *tt_probe(zobrist_t hash);
+
+/**
+ * Stores what a search of the given depth found out about a position.
+ */
+void tt_store(zobrist_t hash, move_t move, int depth, int bound, int score);
+
+#endif /* CHESS_TTABLE */
@@ -8,9 +8,108 @@
 #include <msp430g2553.h>
 #include <serial_led_control.h>
 #include <button_control.h>
+#include <timer_control.h>
+#include <animation_control.h>
 #include <chess_functions.h>
+#include <chess_eval.h>
+#include <chess_search.h>
 
-void show_possible_moves();
+/*
+ * Build with CHESS_VS_BOARD defined to play white against the board, which
+ * answers every move after thinking for up to VS_BOARD_TIME_MS. Pressing
+ * any button while it thinks makes it play the best move found so far. See
+ * chess_search.h for how the search fits the G2553's RAM.
+ */
+#define VS_BOARD_TIME_MS 3000
+
+/*
+ * While the player thinks, the board searches the position after the reply
+ * it expects, for up to PONDER_TIME_MS, and only sleeps once that is done.
+ * The reply it expects is the best one its own search found to the move it
+ * played. If the player makes that move, the search carries on from where
+ * it got to, with the time spent pondering counted against
+ * VS_BOARD_TIME_MS. PONDER_TIME_MS has to stay a few seconds short of the
+ * 65.5 s the millisecond clock takes to wrap around.
+ */
+#define PONDER_TIME_MS 60000
+
+/*
+ * Build with CHESS_HINTS defined to ask for a hint by pressing the selected
+ * piece's square again within HINT_PRESS_MS of selecting it. The board
+ * searches the position for HINT_TIME_MS, going as deep as that allows,
+ * and lights the squares the best move it found goes between. While the
+ * board ponders, the reply it expects is the hint, with no search.
+ *
+ * Define CHESS_HINTS_NO_SEARCH to have the hint be the move
+ * static_exchange() rates best instead, the capture that wins the most if
+ * there is one, which only takes the stack of one exchange. The G2553 has
+ * no RAM for the search next to CHESS_LED_ASYNC's copy of the LED frame
+ * (see chess_search.h), so a build for it with both does this by itself.
+ */
+#define HINT_TIME_MS 500
+#define HINT_PRESS_MS 400
+
+#if defined(CHESS_HINTS) && defined(CHESS_LED_ASYNC) && defined(__MSP430G2553__)
+#define CHESS_HINTS_NO_SEARCH
+#endif
+
+/*
+ * How long the animations the board shows take: a move it plays or hints
+ * at, the sweep across the board at startup, and one blink of the winner's
+ * home rows or one pulse of both sides' for a draw.
+ */
+#define MOVE_ANIMATION_MS 600
+#define SWEEP_ANIMATION_MS 800
+#define WIN_BLINK_MS 1000
+#define DRAW_PULSE_MS 2000
+
+/*
+ * Home rows of each side, as square masks.
+ */
+#define WHITE_HOME_ROWS 0x000000000000FFFFULL
+#define BLACK_HOME_ROWS 0xFFFF000000000000ULL
+
+/*
+ * Build with CHESS_COACHING defined to have the squares a selected piece
+ * can move to graded by what the move risks rather than by whether it
+ * captures: green is safe, amber an even trade, red gives material away.
+ */
+
+int game_over_state();
+void start_board_move();
+void think_board_move();
+void play_board_move();
+void start_pondering();
+void ponder_board_move();
+void show_hint();
+move_t exchange_hint();
+void show_possible_moves(int x_pos, int y_pos);
+
+/*
+ * The game being played on the board, and the positions it went through
+ * since the last capture or pawn move.
+ */
+static chess_position_t game;
+static chess_history_t history;
+
+#ifdef CHESS_VS_BOARD
+/*
+ * The board's reply, searched a slice at a time between button presses,
+ * and when the board started thinking about it: when it started pondering,
+ * if it pondered the move the player made.
+ */
+static search_result_t board_reply;
+static unsigned int think_start;
+static unsigned char board_thinking = 0;
+
+/*
+ * The reply the board expects, whose position it searches while the player
+ * thinks, and whether that search is still going on.
+ */
+static move_t ponder_move;
+static unsigned char board_pondering = 0;
+static unsigned char ponder_done = 0;
+#endif
 
 /*
  * Chess board initialization and main code loop.
@@ -26,27 +125,37 @@ int main(void) {
     // Run setup code:
     serial_led_control_setup();
     button_control_setup();
-    reset_board();
+    timer_control_setup();
+    animation_control_setup();
+    reset_board(&game);
+    reset_history(&history, &game);
     send_serial_led_commands();
+    sweep_squares(WHITE_HOME_ROWS | BLACK_HOME_ROWS | 0x0000FFFFFFFF0000ULL,
+                  0, 255, 0, SWEEP_ANIMATION_MS);
+
+#ifdef CHESS_VS_BOARD
+    // any change of button stops the search, so the loop can see to it
+    set_search_interrupt(&button_event);
+#endif
 
     int last_button_x = -1;
     int last_button_y = -1;
     int last_x_pos = -1;
     int last_y_pos = -1;
-    int side = 0;
-    int state = 0;
-
-    int led_display_counter;
+#ifdef CHESS_HINTS
+    unsigned int select_time = 0;
+#endif
+    int state = 0; // 0: pick a piece, 1: pick a square, 2/3: white/black won, 4: draw
 
     int button_x = -1;
     int button_y = -1;
 
-    int i = 0;
-    int j = 0;
-    int display_flip = 0;
-
     // Main code loop:
     while (1) {
+#ifdef CHESS_VS_BOARD
+        // cleared before the buttons are read, so a later change stops the search
+        button_event = 0;
+#endif
         button_x = active_button_x;
         button_y = active_button_y;
 
@@ -57,65 +166,77 @@ int main(void) {
 
         // button_id = active_button_id;
 
-        if (state == 2 || state == 3) {
-            if (led_display_counter > 10000) {
-                led_display_counter = 0;
-
-                if (display_flip == 0) {
-                    for (i = 6 * (state - 2); i < 2 +  6 * (state - 2); i++) {
-                        for (j = 0; j < 8; j++) {
-                            set_serial_led_color(get_led_id(i, j), 1, 0, 255, 0);
-                        }
-                    }
-                } else {
-                    clear_serial_leds();
-                }
-                display_flip = (display_flip + 1)%2;
+        // ADD SOME PERIODIC CHECKMATE CHECK
 
-                send_serial_led_commands();
+#ifdef CHESS_VS_BOARD
+        if (board_thinking) {
+            // a press cuts the thinking short, anything else lets it go on
+            if ((button_x != last_button_x || button_y != last_button_y) && button_x >= 0) {
+                play_board_move();
+            } else {
+                think_board_move();
             }
-            led_display_counter++;
-        }
+            if (!board_thinking) state = game_over_state();
 
+            last_button_x = button_x;
+            last_button_y = button_y;
+            continue;
+        }
 
-        // ADD SOME PERIODIC CHECKMATE CHECK
+        // use the player's time, but let their presses through first
+        if (board_pondering && !ponder_done && state < 2 && !animation_running() &&
+                button_x == last_button_x && button_y == last_button_y) {
+            ponder_board_move();
+        }
+#endif
 
         if ((button_x != last_button_x || button_y != last_button_y) && button_x >= 0) {
             if (state == 0) {
-                if ((get_piece_at_pos(button_x, button_y) % 100 != 0)
-                    && !((side == 0) && ((get_piece_at_pos(button_x, button_y) % 100) > 10))
-                    && !((side == 1) && ((get_piece_at_pos(button_x, button_y) % 100) < 10))) { 
-                    calculate_moves(button_x, button_y, side);
+                if ((get_piece_at_pos(&game, button_x, button_y) != PIECE_EMPTY)
+                    && (PIECE_SIDE(get_piece_at_pos(&game, button_x, button_y)) == game.side)) {
+                    stop_animation();
                     clear_serial_leds();
-                    send_serial_led_commands();
                     set_serial_led_color(get_led_id(button_x, button_y), 16, 0, 0, 255);
-                    show_possible_moves();
+                    show_possible_moves(button_x, button_y);
                     last_x_pos = button_x;
                     last_y_pos = button_y;
                     state = 1;
+#ifdef CHESS_HINTS
+                    select_time = timer_now();
+#endif
                 }
             } else if (state == 1) {
                 if (button_x == last_x_pos && button_y == last_y_pos) {
-                    revert_board();
                     state = 0;
                     clear_serial_leds();
                     send_serial_led_commands();
-                } else if (send_move(last_x_pos, last_y_pos, button_x, button_y, side)) {
-                    revert_board();
+#ifdef CHESS_HINTS
+                    // a quick second press asks for a hint instead
+                    if ((unsigned int) (timer_now() - select_time) < HINT_PRESS_MS) {
+                        show_hint();
+                    }
+#endif
+                } else if (send_move(&game, last_x_pos, last_y_pos, button_x, button_y)) {
                     state = 0;
-                    side = (side + 1) % 2;
                     clear_serial_leds();
-                    send_serial_led_commands();
                     set_serial_led_color(get_led_id(button_x, button_y), 16, 0, 0, 255);
                     send_serial_led_commands();
 
-                    if (in_checkmate(side)) {
-                        state = 2 + ((side + 1) % 2);
+                    record_position(&history, &game);
+                    state = game_over_state();
+
+#ifdef CHESS_VS_BOARD
+                    if (state == 0) {
+                        start_board_move();
+                        if (!board_thinking) state = game_over_state();
                     }
+#endif
                 }
-            } else if (state == 2 || state == 3) {
+            } else if (state >= 2) {
+                stop_animation();
                 clear_serial_leds();
                 send_serial_led_commands();
+                wait_serial_leds();
                 state = 0;
                 WDTCTL = 0;
             }
@@ -139,28 +260,253 @@ int main(void) {
             // send_serial_led_commands();
         // }
 
-        if (state != 2 && state != 3) __bis_SR_register(LPM0_bits);
+        // a finished game shows who won until a button resets the board,
+        // once the last move has been shown
+        if (state >= 2 && !animation_running()) {
+            clear_serial_leds();
+            if (state == 4) {
+                pulse_squares(WHITE_HOME_ROWS | BLACK_HOME_ROWS, 255, 255, 0, DRAW_PULSE_MS);
+            } else {
+                blink_squares(state == 2 ? WHITE_HOME_ROWS : BLACK_HOME_ROWS,
+                              0, 255, 0, WIN_BLINK_MS);
+            }
+        }
+        update_animation();
+
+#ifdef CHESS_VS_BOARD
+        if (board_pondering && !ponder_done && state < 2 && !animation_running()) continue;
+#endif
+        // Timer1_A wakes the loop for each frame while an animation runs.
+        __bis_SR_register(LPM0_bits);
+    }
+}
+
+/*
+ * Works out whether the move just played ended the game.
+ *
+ * Returns: 0 if the game goes on, 2/3 if white/black won, 4 if drawn
+ */
+int game_over_state() {
+    switch (game_status(&game)) {
+        case GAME_CHECKMATE:
+            return 2 + ((game.side + 1) % 2);
+        case GAME_STALEMATE:
+            return 4;
+    }
+    if (draw_status(&history, &game) != GAME_ONGOING) return 4;
+    return 0;
+}
+
+#ifdef CHESS_VS_BOARD
+/*
+ * Let the board start searching for its reply. If the player made the move
+ * it was pondering, the search goes on from the ponder search, which has
+ * been using up the board's time since it started. The reply is played
+ * straight away if the search finishes without a button changing, and
+ * otherwise board_thinking is left set for the main loop to carry on with.
+ */
+void start_board_move() {
+    if (board_pondering && search_resumable(&game)) {
+        // once pondering is done its time is all used up, however long ago
+        // it started, which could be longer than the clock goes round in
+        if (ponder_done) think_start = timer_now() - VS_BOARD_TIME_MS;
+    } else {
+        think_start = timer_now();
+    }
+    board_pondering = 0;
+    board_thinking = 1;
+
+    // search_resume() starts over unless the position is the pondered one
+    think_board_move();
+}
+
+/*
+ * Carry on with the board's search for what is left of its time, and play
+ * the reply once it is done.
+ */
+void think_board_move() {
+    unsigned int spent = timer_now() - think_start;
+
+    if (spent >= VS_BOARD_TIME_MS ||
+            search_resume(&game, VS_BOARD_TIME_MS - spent, &board_reply) != SEARCH_INTERRUPTED) {
+        play_board_move();
+    }
+}
+
+/*
+ * Play the best reply the board found, then show the move on the LEDs,
+ * ending on the squares the piece moved between, so the player can move
+ * it on the real board.
+ */
+void play_board_move() {
+    int from;
+    int to;
+
+    board_thinking = 0;
+    make_move(&game, board_reply.move, 0);
+    record_position(&history, &game);
+
+    from = MOVE_FROM(board_reply.move);
+    to = MOVE_TO(board_reply.move);
+    clear_serial_leds();
+    animate_move(from, to, 0, 255, 255, MOVE_ANIMATION_MS);
+
+    start_pondering();
+}
+
+/*
+ * Take the player's reply to be the best one the board's search found to
+ * its move, and start searching the position it leads to. Nothing is
+ * pondered if the search found no reply, as when it didn't get past its
+ * first iteration, which looks no further than the board's own move.
+ */
+void start_pondering() {
+    board_pondering = 0;
+
+    // a reply found through the hash table may come from another position
+    if (!board_reply.reply || !is_legal_move(&game, board_reply.reply)) return;
+
+    // the main loop starts the search once the move has been shown
+    ponder_move = board_reply.reply;
+    think_start = timer_now();
+    board_pondering = 1;
+    ponder_done = 0;
+}
+
+/*
+ * Carry on pondering until a button changes, marking it done once the
+ * search runs out of time or depth.
+ */
+void ponder_board_move() {
+    unsigned int spent = timer_now() - think_start;
+
+    if (spent >= PONDER_TIME_MS ||
+            search_ponder(&game, ponder_move, PONDER_TIME_MS - spent,
+                          &board_reply) != SEARCH_INTERRUPTED) {
+        ponder_done = 1;
     }
 }
+#endif
 
-static volatile int test;
-void show_possible_moves() {
+#ifdef CHESS_HINTS
+/*
+ * Light the squares the best move for the side to move goes between. If
+ * the board is pondering, the reply it expects is the best move its own
+ * search found for the game, so that is shown and the ponder search is
+ * left to carry on. Otherwise the game is searched for HINT_TIME_MS.
+ * Iterative deepening makes the depth fit the time: the search stops
+ * mid-iteration when the time is up and keeps the move of the last one it
+ * finished, so the hint is lit within a few milliseconds of HINT_TIME_MS.
+ * Built with CHESS_HINTS_NO_SEARCH, the hint comes from exchange_hint().
+ */
+void show_hint() {
+#ifndef CHESS_HINTS_NO_SEARCH
+    search_result_t hint;
+#endif
+    move_t move;
+
+#ifdef CHESS_VS_BOARD
+    if (board_pondering) {
+        animate_move(MOVE_FROM(ponder_move), MOVE_TO(ponder_move),
+                     255, 0, 255, MOVE_ANIMATION_MS);
+        return;
+    }
+#endif
+
+#ifdef CHESS_HINTS_NO_SEARCH
+    move = exchange_hint();
+#else
+#ifdef CHESS_VS_BOARD
+    // releasing the button would stop the search straight away
+    set_search_interrupt(0);
+#endif
+    move = 0;
+    if (search_best_move(&game, HINT_TIME_MS, &hint) != SEARCH_NO_MOVE) {
+        move = hint.move;
+    }
+#ifdef CHESS_VS_BOARD
+    set_search_interrupt(&button_event);
+#endif
+#endif
+
+    if (move) {
+        animate_move(MOVE_FROM(move), MOVE_TO(move), 255, 0, 255, MOVE_ANIMATION_MS);
+    }
+}
+
+/*
+ * Finds the move of the side to move that static_exchange() rates best: the
+ * capture or promotion that wins the most material if one wins any, or
+ * else the first move that loses none, or else the one that loses least.
+ * The moves are walked one at a time, so it takes no more stack than one
+ * static_exchange().
+ *
+ * Returns: the move, or 0 if there are no legal moves
+ */
+move_t exchange_hint() {
+    move_t move = 0;
+    move_t best = 0;
+    int best_gain = 0;
+    int gain;
+
+    while ((move = next_legal_move(&game, move, MOVES_CAPTURES)) != 0) {
+        gain = static_exchange(&game, move);
+        if (!best || gain > best_gain) {
+            best = move;
+            best_gain = gain;
+        }
+    }
+    if (best_gain > 0) return best;
+
+    while ((move = next_legal_move(&game, move, MOVES_QUIETS)) != 0) {
+        gain = static_exchange(&game, move);
+        if (gain >= 0) return move;
+        if (!best || gain > best_gain) {
+            best = move;
+            best_gain = gain;
+        }
+    }
+    return best;
+}
+#endif
+
+/*
+ * Lights the squares the piece at the given position can move to: green
+ * for a move and red for a capture. Coaching grades each move with
+ * exchange_grade() instead, green, amber or red, which walks out from the
+ * square once per move; a queen's 27 moves should take a few milliseconds
+ * at 8 MHz, under the time one LED frame takes to send. Only the queen is
+ * shown for a promotion, as send_move() promotes to one.
+ */
+void show_possible_moves(int x_pos, int y_pos) {
+    move_t moves[MAX_PIECE_MOVES];
+    int num_moves = generate_piece_moves(&game, x_pos, y_pos, moves);
+    int led;
     int i;
-    int j;
-    int temp_piece;
-    for (i = 0; i < 8; i++) {
-        for (j = 0; j < 8; j++) {
-            temp_piece = get_piece_at_pos(i, j);
-            test = temp_piece;
-            if (temp_piece >= 100 && temp_piece < 200) {
-                set_serial_led_color(get_led_id(i, j), 16,
-                         0, 255, 0);
-            } else if (temp_piece >= 200) {
-                set_serial_led_color(get_led_id(i, j), 16,
-                         255, 0, 0);
-            }
+
+    for (i = 0; i < num_moves; i++) {
+        if (MOVE_IS_PROMOTION(moves[i]) && MOVE_PROMOTION_PIECE(moves[i]) != PIECE_QUEEN) {
+            continue;
         }
+        led = get_led_id(SQUARE_X(MOVE_TO(moves[i])), SQUARE_Y(MOVE_TO(moves[i])));
+#ifdef CHESS_COACHING
+        switch (exchange_grade(&game, moves[i])) {
+            case EXCHANGE_SAFE:
+                set_serial_led_color(led, 16, 0, 255, 0);
+                break;
+            case EXCHANGE_EVEN:
+                set_serial_led_color(led, 16, 255, 96, 0);
+                break;
+            default:
+                set_serial_led_color(led, 16, 255, 0, 0);
+        }
+#else
+        if (MOVE_IS_CAPTURE(moves[i])) {
+            set_serial_led_color(led, 16, 255, 0, 0);
+        } else {
+            set_serial_led_color(led, 16, 0, 255, 0);
+        }
+#endif
     }
     send_serial_led_commands();
 }
-
@@ -9,14 +9,68 @@
 #include <serial_led_control.h>
 
 /*
- * Define the number of bytes of storage required to hold the control bytes.
+ * Each LED passes the data on half a clock late, so after the colors of the
+ * first n LEDs another n / 2 clocks are needed to get them to the last one.
+ * They are sent as zero bytes, which the LEDs past the ones sent to can only
+ * take for part of a start frame, never for colors.
  */
-#define NUM_SERIAL_ARRAY_BYTES ((NUM_SERIAL_LEDS << 2) + 8)
+#define NUM_END_FRAME_BYTES(n) (((n) + 15) >> 4)
 
 /*
- * Array to hold the control bytes for the N LEDs in the LED chain.
+ * Palette color of an LED in a list of colors. Even LEDs sit in the low
+ * nibble of their byte, odd LEDs in the high one.
  */
-static unsigned char led_control_bytes[NUM_SERIAL_ARRAY_BYTES];
+#define LED_COLOR(colors, led) \
+    (((colors)[(led) >> 1] >> (((led) & 1) << 2)) & 0x0F)
+
+/*
+ * The colors in use, each as the 4 bytes an LED takes: global brightness,
+ * blue, green and red. Color 0 is off and never changes.
+ */
+static unsigned char led_palette[NUM_LED_COLORS][4];
+
+/*
+ * Which palette color each LED in the chain shows, two LEDs per byte.
+ */
+static unsigned char led_colors[NUM_SERIAL_LEDS / 2];
+
+/*
+ * One past the last LED whose color changed since the last frame. The LEDs
+ * keep their colors until a frame reaches them, so a frame only has to go
+ * this far down the chain, and isn't needed at all while it is 0.
+ */
+static volatile unsigned char led_dirty_end = 0;
+
+/*
+ * Non-zero while a frame is being sent or waits to be.
+ */
+volatile unsigned char serial_led_sending = 0;
+
+#ifdef CHESS_LED_ASYNC
+/*
+ * The frame the USCI interrupt is sending, copied from led_colors and
+ * led_palette when it was committed so the colors can change while it goes
+ * out: its colors, how many bytes of it are start frame and colors, how
+ * many in all, and the index of the next byte to send.
+ */
+static unsigned char led_frame_colors[NUM_SERIAL_LEDS / 2];
+static unsigned char led_frame_palette[NUM_LED_COLORS][4];
+static volatile unsigned int led_frame_data;
+static volatile unsigned int led_frame_length;
+static volatile unsigned int led_frame_index;
+
+/*
+ * Set when a frame is committed while another is being sent. Any number of
+ * commits in that time are sent as one frame once it is done.
+ */
+static volatile unsigned char led_frame_pending = 0;
+
+static void start_led_frame();
+#else
+static void send_led_byte(unsigned char b);
+#endif
+static int find_led_color(unsigned char global_val, unsigned char r_val,
+                          unsigned char g_val, unsigned char b_val);
 
 /*
  * Set the global brightness and RGB value of the specified LED. Note: this
@@ -31,24 +85,36 @@ static unsigned char led_control_bytes[NUM_SERIAL_ARRAY_BYTES];
  *     b_val - a byte value controlling the blue value of the LED
  *
  * Returns:
- *     1 if the function was successful, 0 if there was an error.
+ *     1 if the function was successful, 0 if there was an error: the index
+ *     is out of range, or NUM_LED_COLORS other colors are already lit.
  */
 int set_serial_led_color(unsigned int led_idx, unsigned char global_val,
                          unsigned char r_val, unsigned char g_val,
                          unsigned char b_val) {
+    unsigned char *pair;
+    int shift;
+    int color;
+
     if ((led_idx + 1) > NUM_SERIAL_LEDS) {
         // Invalid index, return failure.
         return 0;
     }
 
-    // Calculate index in array where data is stored.
-    unsigned int arr_idx = (led_idx << 2) + 4;
+    color = find_led_color(global_val, r_val, g_val, b_val);
+    if (color < 0) {
+        // Palette full, return failure.
+        return 0;
+    }
 
-    // Set the 4 bytes in the array corresponding to the specified LED.
-    led_control_bytes[arr_idx] = 0xE0 | global_val;
-    led_control_bytes[arr_idx + 1] = b_val;
-    led_control_bytes[arr_idx + 2] = g_val;
-    led_control_bytes[arr_idx + 3] = r_val;
+    // Leave the LED out of the next frame if it already has this color.
+    pair = &led_colors[led_idx >> 1];
+    shift = (led_idx & 1) << 2;
+    if (((*pair >> shift) & 0x0F) != color) {
+        *pair = (*pair & ~(0x0F << shift)) | (color << shift);
+        if (led_idx >= led_dirty_end) {
+            led_dirty_end = led_idx + 1;
+        }
+    }
 
     return 1;
 }
@@ -58,13 +124,18 @@ int set_serial_led_color(unsigned int led_idx, unsigned char global_val,
  * commands to the LEDs.
  */
 void clear_serial_leds() {
+    unsigned int end;
     unsigned int i;
 
-    for (i = 4; i < NUM_SERIAL_ARRAY_BYTES - 4; i += 4) {
-        led_control_bytes[i] = 0xE0; // Global brightness value
-        led_control_bytes[i + 1] = 0x00; // RGB values:
-        led_control_bytes[i + 2] = 0x00;
-        led_control_bytes[i + 3] = 0x00;
+    // two LEDs at a time, the frame reaching the odd one only if it was lit
+    for (i = 0; i < NUM_SERIAL_LEDS / 2; i++) {
+        if (led_colors[i]) {
+            end = (i << 1) + (led_colors[i] > 0x0F ? 2 : 1);
+            led_colors[i] = 0;
+            if (end > led_dirty_end) {
+                led_dirty_end = end;
+            }
+        }
     }
 }
 
@@ -72,30 +143,103 @@ void clear_serial_leds() {
  * Send the LED control commands to the LEDs via SPI.
  *
  * Synchronous, waits until LED commands are completely sent before returning.
+ * Built with CHESS_LED_ASYNC, commits them instead: the frame is taken as
+ * it is and sent by the USCI interrupt, and this returns straight away.
+ *
+ * Only sends as far down the chain as the last LED changed since the last
+ * frame, and nothing if none changed.
  */
+#ifdef CHESS_LED_ASYNC
 void send_serial_led_commands() {
+    if (!led_dirty_end) return;
+
+    // Keep the interrupt out while deciding, so it can't finish a frame
+    // between the check and setting the pending flag.
+    IE2 &= ~UCB0TXIE;
+    if (serial_led_sending) {
+        led_frame_pending = 1;
+    } else {
+        serial_led_sending = 1;
+        start_led_frame();
+    }
+    IE2 |= UCB0TXIE;
+}
+#else
+void send_serial_led_commands() {
+    unsigned char num_leds = led_dirty_end;
+    unsigned int end_bytes = NUM_END_FRAME_BYTES(num_leds);
+    const unsigned char *color;
     unsigned int i;
-    unsigned char j;
 
-    // Iterate through each byte in the led_control_bytes array
-    for (i = 0; i < NUM_SERIAL_ARRAY_BYTES; i++) {
-        unsigned char b = led_control_bytes[i];
-
-        for (j = 0x80; j != 0; j = j >> 1) {
-            // Send clock low.
-            P1OUT &= ~BIT5;
-            if (b & j) {
-                // Send data high.
-                P1OUT |= BIT7;
-            } else {
-                // Send data low.
-                P1OUT &= ~BIT7;
-            }
-            // Send clock high.
-            P1OUT |= BIT5;
+    if (!num_leds) return;
+    led_dirty_end = 0;
+
+    // Start frame
+    for (i = 0; i < 4; i++) {
+        send_led_byte(0x00);
+    }
+
+    // The 4 bytes of each LED, looked up in the palette
+    for (i = 0; i < num_leds; i++) {
+        color = led_palette[LED_COLOR(led_colors, i)];
+        send_led_byte(color[0]);
+        send_led_byte(color[1]);
+        send_led_byte(color[2]);
+        send_led_byte(color[3]);
+    }
+
+    // End frame
+    for (i = 0; i < end_bytes; i++) {
+        send_led_byte(0x00);
+    }
+
+#ifdef CHESS_LED_SPI
+    // Wait for the last byte to leave the shift register.
+    while (UCB0STAT & UCBUSY);
+#endif
+}
+#endif
+
+/*
+ * Wait until every committed frame has been sent. Nothing to wait for
+ * unless built with CHESS_LED_ASYNC.
+ */
+void wait_serial_leds() {
+    while (serial_led_sending);
+#ifdef CHESS_LED_SPI
+    while (UCB0STAT & UCBUSY);
+#endif
+}
+
+#ifdef CHESS_LED_ASYNC
+/*
+ * USCI_A0/B0 transmit interrupt vector. Feeds the next byte of the frame
+ * to USCI_B0, looking the colors up in the palette as it goes, then starts
+ * the pending frame if there is one, or turns itself off.
+ */
+#pragma vector=USCIAB0TX_VECTOR
+__interrupt void usci_tx_interrupt (void) {
+    unsigned int i = led_frame_index++;
+
+    if (i >= 4 && i < led_frame_data) {
+        UCB0TXBUF = led_frame_palette[LED_COLOR(led_frame_colors, (i - 4) >> 2)][i & 0x03];
+    } else {
+        // Start or end frame
+        UCB0TXBUF = 0x00;
+    }
+
+    if (led_frame_index == led_frame_length) {
+        if (led_frame_pending && led_dirty_end) {
+            led_frame_pending = 0;
+            start_led_frame();
+        } else {
+            led_frame_pending = 0;
+            IE2 &= ~UCB0TXIE;
+            serial_led_sending = 0;
         }
     }
 }
+#endif
 
 /*
  * Perform all the required initial setup for this module:
@@ -109,24 +253,37 @@ void serial_led_control_setup() {
     // Disable interrupts while setting up serial LED control:
     __disable_interrupt();
 
-    // Initialize data storage for serial LED control:
-    for (i = 0; i < NUM_SERIAL_ARRAY_BYTES; i++) {
-        if (i < 4) {
-            led_control_bytes[i] = 0x00; // Start frame
-        } else if (NUM_SERIAL_ARRAY_BYTES - i <= 4) {
-            led_control_bytes[i] = 0xFF; // End frame
-        } else if (i & 0x03) {
-            led_control_bytes[i] = 0x00; // RGB value
-        } else {
-            led_control_bytes[i] = 0xE0; // Global brightness value
-        }
+    // Initialize data storage for serial LED control, every LED off:
+    for (i = 0; i < NUM_SERIAL_LEDS / 2; i++) {
+        led_colors[i] = 0;
     }
+    led_palette[0][0] = 0xE0; // Global brightness value
+    led_palette[0][1] = 0x00; // RGB values:
+    led_palette[0][2] = 0x00;
+    led_palette[0][3] = 0x00;
+    // Whatever the LEDs came up showing, the first frame turns them all off.
+    led_dirty_end = NUM_SERIAL_LEDS;
 
+#ifdef CHESS_LED_SPI
+    // Hold USCI_B0 in reset while setting it up as an SPI master sending
+    // MSB first, with the clock idling high and data changing on its falling
+    // edge so the LEDs latch it on the rising one:
+    UCB0CTL1 = UCSWRST | UCSSEL_2;
+    UCB0CTL0 = UCCKPL | UCMSB | UCMST | UCSYNC;
+    // Clock at SMCLK / 2:
+    UCB0BR0 = 2;
+    UCB0BR1 = 0;
+    // Hand P1.5 and P1.7 to the USCI as UCB0CLK and UCB0SIMO:
+    P1SEL |= BIT5 | BIT7;
+    P1SEL2 |= BIT5 | BIT7;
+    UCB0CTL1 &= ~UCSWRST;
+#else
     // Configure I/O pins for output:
     P1DIR |= BIT5 | BIT7;
     // Set data to low, clock to high:
     P1OUT &= ~BIT7;
     P1OUT |= BIT5;
+#endif
 
     // Globally enable all interrupts:
     __enable_interrupt();
@@ -135,3 +292,94 @@ void serial_led_control_setup() {
     // about 0.05 seconds, the LEDs should be ready at this point.
     __delay_cycles(50000);
 }
+
+#ifdef CHESS_LED_ASYNC
+/*
+ * Take the colors as they are now, as far as the last changed LED, as the
+ * frame to send, from its first byte. A frame taken while the colors are
+ * half changed is soon followed by the one committed after the change.
+ */
+static void start_led_frame() {
+    unsigned char num_leds = led_dirty_end;
+    const unsigned char *from = led_palette[0];
+    unsigned char *to = led_frame_palette[0];
+    unsigned int i;
+
+    led_dirty_end = 0;
+    led_frame_data = 4 + (num_leds << 2);
+    led_frame_length = led_frame_data + NUM_END_FRAME_BYTES(num_leds);
+
+    for (i = 0; i < num_leds; i += 2) {
+        led_frame_colors[i >> 1] = led_colors[i >> 1];
+    }
+    for (i = 0; i < NUM_LED_COLORS * 4; i++) {
+        to[i] = from[i];
+    }
+    led_frame_index = 0;
+}
+#else
+/*
+ * Send one byte down the chain, MSB first.
+ */
+static void send_led_byte(unsigned char b) {
+#ifdef CHESS_LED_SPI
+    // Hand the byte over as soon as the transmit buffer frees up, so it is
+    // already waiting when the shift register runs out.
+    while (!(IFG2 & UCB0TXIFG));
+    UCB0TXBUF = b;
+#else
+    unsigned char j;
+
+    for (j = 0x80; j != 0; j = j >> 1) {
+        // Send clock low.
+        P1OUT &= ~BIT5;
+        if (b & j) {
+            // Send data high.
+            P1OUT |= BIT7;
+        } else {
+            // Send data low.
+            P1OUT &= ~BIT7;
+        }
+        // Send clock high.
+        P1OUT |= BIT5;
+    }
+#endif
+}
+#endif
+
+/*
+ * Finds the palette color with the given brightness and RGB value, adding
+ * it in place of a color no LED shows any more if there is none.
+ *
+ * Returns: the color, or -1 if the palette is full
+ */
+static int find_led_color(unsigned char global_val, unsigned char r_val,
+                          unsigned char g_val, unsigned char b_val) {
+    unsigned char global_byte = 0xE0 | global_val;
+    unsigned int shown = 0x01; // off is never given up
+    int i;
+
+    for (i = 0; i < NUM_LED_COLORS; i++) {
+        if (led_palette[i][0] == global_byte && led_palette[i][1] == b_val &&
+                led_palette[i][2] == g_val && led_palette[i][3] == r_val) {
+            return i;
+        }
+    }
+
+    // Only reached when a new color comes into use, so walking the LEDs
+    // for the colors still shown costs little.
+    for (i = 0; i < NUM_SERIAL_LEDS / 2; i++) {
+        shown |= 1 << (led_colors[i] & 0x0F);
+        shown |= 1 << (led_colors[i] >> 4);
+    }
+    for (i = 1; i < NUM_LED_COLORS; i++) {
+        if (!(shown & (1 << i))) {
+            led_palette[i][0] = global_byte;
+            led_palette[i][1] = b_val;
+            led_palette[i][2] = g_val;
+            led_palette[i][3] = r_val;
+            return i;
+        }
+    }
+    return -1;
+}
@@ -13,6 +13,35 @@
  */
 #define NUM_SERIAL_LEDS 64
 
+/*
+ * Number of different colors, off included, the LEDs can show at once, up
+ * to 16. Each LED only stores which of them it shows, in half a byte, so
+ * the colors take 64 bytes rather than 4 per LED: 32 for the LEDs and 4
+ * per color.
+ */
+#define NUM_LED_COLORS 8
+
+/*
+ * The LEDs are sent to by bit-banging P1.5 and P1.7, which keeps the CPU
+ * busy for every bit. Build with CHESS_LED_SPI defined to send through
+ * USCI_B0 instead, whose UCB0CLK and UCB0SIMO pins those are, clocked at
+ * SMCLK / 2 (4 MHz). Going by cycle counts at 8 MHz, a 264 byte frame takes
+ * about 6 ms bit-banged and about 0.55 ms over the USCI.
+ *
+ * Build with CHESS_LED_ASYNC defined as well to have the USCI interrupt
+ * send the frame while the main loop goes on. It keeps a second copy of
+ * the colors to send from, which takes another 64 bytes of RAM.
+ */
+#if defined(CHESS_LED_ASYNC) && !defined(CHESS_LED_SPI)
+#define CHESS_LED_SPI
+#endif
+
+/*
+ * Non-zero while a frame is being sent or waits to be, so always 0 unless
+ * built with CHESS_LED_ASYNC.
+ */
+extern volatile unsigned char serial_led_sending;
+
 /*
  * Perform all the required initial setup for this module:
  *     Setup pin P1.7 as SIMO data line.
@@ -34,7 +63,8 @@ void serial_led_control_setup();
  *     b_val - a byte value controlling the blue value of the LED
  *
  * Returns:
- *     1 if the function was successful, 0 if there was an error.
+ *     1 if the function was successful, 0 if there was an error: the index
+ *     is out of range, or NUM_LED_COLORS other colors are already lit.
  */
 int set_serial_led_color(unsigned int led_idx, unsigned char global_val,
                          unsigned char r_val, unsigned char g_val,
@@ -50,7 +80,19 @@ void clear_serial_leds();
  * Send the LED control commands to the LEDs via SPI.
  *
  * Synchronous, waits until LED commands are completely sent before returning.
+ * Built with CHESS_LED_ASYNC, commits them instead: the frame is taken as
+ * it is and sent by the USCI interrupt, and this returns straight away.
+ * Frames committed while one is being sent are merged into one.
+ *
+ * Only sends as far down the chain as the last LED changed since the last
+ * frame, and nothing if none changed.
  */
 void send_serial_led_commands();
 
+/*
+ * Wait until every committed frame has been sent. Nothing to wait for
+ * unless built with CHESS_LED_ASYNC.
+ */
+void wait_serial_leds();
+
 #endif /* CHESS_SERIAL_LED_CONTROL */
@@ -0,0 +1,46 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Code for the millisecond clock kept by Timer0_A.
+ */
+#include <msp430g2553.h>
+#include <timer_control.h>
+
+/*
+ * Milliseconds counted by the Timer0_A interrupt. A single word, so reading
+ * it from the main loop can't catch it half updated.
+ */
+static volatile unsigned int timer_ms = 0;
+
+/*
+ * Milliseconds since timer_control_setup(). Wraps around every 65.5 seconds,
+ * so only compare readings by subtracting them.
+ */
+unsigned int timer_now() {
+    return timer_ms;
+}
+
+/*
+ * Timer0_A CCR0 interrupt vector. Counts off one millisecond.
+ */
+#pragma vector=TIMER0_A0_VECTOR
+__interrupt void timer0_a0_interrupt (void) {
+    timer_ms++;
+}
+
+/*
+ * Perform all the required initial setup for this module:
+ *     Setup Timer0_A to interrupt every 1ms from SMCLK.
+ *     Enable global interrupts.
+ */
+void timer_control_setup() {
+    // Count SMCLK / 8 = 1MHz up to 1000 (main clock assumed to be 8MHz):
+    TA0CCR0 = 1000 - 1;
+    TA0CCTL0 = CCIE;
+    TA0CTL = TASSEL_2 + ID_3 + MC_1 + TACLR;
+
+    // Enable global interrupts:
+    __enable_interrupt();
+}
@@ -0,0 +1,24 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for the millisecond clock kept by Timer0_A.
+ */
+#ifndef CHESS_TIMER_CONTROL
+#define CHESS_TIMER_CONTROL
+
+/*
+ * Milliseconds since timer_control_setup(). Wraps around every 65.5 seconds,
+ * so only compare readings by subtracting them.
+ */
+unsigned int timer_now();
+
+/*
+ * Perform all the required initial setup for this module:
+ *     Setup Timer0_A to interrupt every 1ms from SMCLK.
+ *     Enable global interrupts.
+ */
+void timer_control_setup();
+
+#endif /* CHESS_TIMER_CONTROL */
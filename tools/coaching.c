@@ -0,0 +1,107 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Host tool that checks the grades exchange_grade() gives the moves the
+ * board coaches on, with the same chess_eval.c the board runs. Each check
+ * is a position, a move in it and the grade the player should be shown.
+ *
+ * Build and run from the top of the repository:
+ *     gcc -O2 -I. -o coaching tools/coaching.c tools/fen.c chess_functions.c \
+ *         chess_eval.c chess_tables.c
+ *     ./coaching
+ */
+#include <stdio.h>
+
+#include <chess_functions.h>
+#include <chess_eval.h>
+#include "fen.h"
+
+struct check {
+    const char *name;
+    const char *fen;
+    const char *move;
+    int grade;
+};
+
+static const struct check checks[] = {
+    // the rook on d1 is behind the white rook, it can't take first
+    { "x-ray",
+      "4k3/8/8/8/8/1N1R4/7K/3r4 w - - 0 1", "b3d4", EXCHANGE_SAFE },
+    { "hanging",
+      "3rk3/8/8/8/8/1N6/7K/8 w - - 0 1", "b3d4", EXCHANGE_LOSES },
+    { "pawn trade",
+      "4k3/8/2p5/3p4/4P3/8/7K/8 w - - 0 1", "e4d5", EXCHANGE_EVEN },
+    { "free pawn",
+      "4k3/8/8/3p4/4P3/8/7K/8 w - - 0 1", "e4d5", EXCHANGE_SAFE },
+    // the rook can take but loses itself to the pawn on e3
+    { "bad retake",
+      "3rk3/8/8/8/8/1N2P3/7K/8 w - - 0 1", "b3d4", EXCHANGE_SAFE },
+    // the knight on e6 is pinned to its king by the rook on e1
+    { "pinned",
+      "4k3/8/4n3/8/8/1N6/7K/4R3 w - - 0 1", "b3d4", EXCHANGE_SAFE },
+    // the king can't take a knight the pawn on c3 guards
+    { "guarded",
+      "8/8/8/4k3/8/1NP5/7K/8 w - - 0 1", "b3d4", EXCHANGE_SAFE },
+    { "knights",
+      "4k3/8/4n3/8/8/1N2P3/7K/8 w - - 0 1", "b3d4", EXCHANGE_EVEN },
+};
+
+#define NUM_CHECKS (sizeof(checks) / sizeof(checks[0]))
+
+static const char *const grade_names[] = { "safe", "even", "loses" };
+
+/*
+ * Find the legal move with the given from and to squares, written like
+ * "e2e4". A promotion matches whichever piece is generated first.
+ *
+ * Returns: 1 and the move if it is legal, 0 if not
+ */
+static int find_move(chess_position_t *pos, const char *text, move_t *move) {
+    move_t moves[MAX_MOVES];
+    int num_moves = generate_legal_moves(pos, moves);
+    int from = SQUARE(text[1] - '1', 7 - (text[0] - 'a'));
+    int to = SQUARE(text[3] - '1', 7 - (text[2] - 'a'));
+    int i;
+
+    for (i = 0; i < num_moves; i++) {
+        if (MOVE_FROM(moves[i]) == from && MOVE_TO(moves[i]) == to) {
+            *move = moves[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(void) {
+    chess_position_t pos;
+    move_t move;
+    int failures = 0;
+    int grade;
+    int i;
+
+    for (i = 0; i < (int) NUM_CHECKS; i++) {
+        if (!load_fen(&pos, checks[i].fen) || !find_move(&pos, checks[i].move, &move)) {
+            printf("%-10s  %s  can't play it\n", checks[i].name, checks[i].move);
+            failures++;
+            continue;
+        }
+
+        grade = exchange_grade(&pos, move);
+        printf("%-10s  %s  %-5s", checks[i].name, checks[i].move, grade_names[grade]);
+        if (grade == checks[i].grade) {
+            printf("  ok\n");
+        } else {
+            printf("  FAIL, expected %s\n", grade_names[checks[i].grade]);
+            failures++;
+        }
+    }
+
+    if (failures) {
+        printf("%d grade(s) wrong\n", failures);
+        return 1;
+    }
+    printf("all grades match\n");
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Reads FEN positions for the host tools.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include <chess_functions.h>
+#include <chess_eval.h>
+#include "fen.h"
+
+/*
+ * Set up a position from a FEN string. The board is mirrored from the usual
+ * diagram: row x is rank x + 1 and column y is file h - y.
+ *
+ * Returns: 1 on success, 0 if the string isn't a position the tools read
+ */
+int load_fen(chess_position_t *pos, const char *fen) {
+    static const char piece_letters[] = "PRNBQK";
+    const char *letter;
+    int x_pos = 7;
+    int file = 0;
+    int square;
+    int piece;
+    int side;
+
+    memset(pos, 0, sizeof(*pos));
+    pos->king[0] = NO_SQUARE;
+    pos->king[1] = NO_SQUARE;
+
+    for (; *fen && *fen != ' '; fen++) {
+        if (*fen == '/') {
+            x_pos--;
+            file = 0;
+        } else if (*fen >= '1' && *fen <= '8') {
+            file += *fen - '0';
+        } else {
+            side = (*fen >= 'a');
+            letter = strchr(piece_letters, side ? *fen - 'a' + 'A' : *fen);
+            if (!letter || x_pos < 0 || file > 7) return 0;
+
+            square = SQUARE(x_pos, 7 - file);
+            piece = MAKE_PIECE(side, letter - piece_letters + 1);
+            pos->board[square >> 1] |= piece << ((square & 1) << 2);
+
+            if (PIECE_TYPE(piece) == PIECE_KING) pos->king[side] = square;
+            file++;
+        }
+    }
+    if (pos->king[0] == NO_SQUARE || pos->king[1] == NO_SQUARE) return 0;
+
+    if (*fen++ != ' ') return 0;
+    pos->side = (*fen++ == 'b');
+
+    if (*fen++ != ' ') return 0;
+    for (; *fen && *fen != ' '; fen++) {
+        if (*fen == 'K') pos->castling |= CASTLE_WHITE_KING;
+        if (*fen == 'Q') pos->castling |= CASTLE_WHITE_QUEEN;
+        if (*fen == 'k') pos->castling |= CASTLE_BLACK_KING;
+        if (*fen == 'q') pos->castling |= CASTLE_BLACK_QUEEN;
+    }
+
+    pos->ep_square = NO_SQUARE;
+    if (*fen == ' ' && fen[1] >= 'a' && fen[1] <= 'h') {
+        pos->ep_square = SQUARE(fen[2] - '1', 7 - (fen[1] - 'a'));
+        fen += 3;
+    } else if (*fen == ' ') {
+        fen += 2;
+    }
+
+    if (*fen == ' ') pos->halfmove = atoi(fen + 1);
+    pos->hash = position_hash(pos);
+    reset_score(pos);
+    return 1;
+}
@@ -0,0 +1,21 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Header file for reading FEN positions in the host tools.
+ */
+#ifndef CHESS_TOOLS_FEN
+#define CHESS_TOOLS_FEN
+
+#include <chess_functions.h>
+
+/*
+ * Set up a position from a FEN string. The board is mirrored from the usual
+ * diagram: row x is rank x + 1 and column y is file h - y.
+ *
+ * Returns: 1 on success, 0 if the string isn't a position the tools read
+ */
+int load_fen(chess_position_t *pos, const char *fen);
+
+#endif /* CHESS_TOOLS_FEN */
@@ -0,0 +1,327 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Host tool that writes chess_tables.c, the constant lookup tables used by
+ * the move generators, the piece-square tables of the evaluation and the
+ * Zobrist keys used to hash positions. The tables are const so they end up
+ * in flash on the MSP430 and cost no RAM.
+ *
+ * Regenerate after changing this file:
+ *     gcc -o gen_chess_tables tools/gen_chess_tables.c
+ *     ./gen_chess_tables > chess_tables.c
+ */
+#include <stdio.h>
+
+/*
+ * Step directions, in the order the move generators rely on: the first four
+ * are the rook directions (rows, then columns), the last four the bishop
+ * directions (towards black's side first).
+ */
+static const int direction_x[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+static const int direction_y[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+
+static const int knight_x[8] = { 1, 2,  1,  2, -1, -2, -1, -2 };
+static const int knight_y[8] = { 2, 1, -2, -1,  2,  1, -2, -1 };
+
+static int on_board(int x_pos, int y_pos) {
+    return x_pos >= 0 && x_pos < 8 && y_pos >= 0 && y_pos < 8;
+}
+
+/*
+ * Print a [64][9] table of target squares for a piece making single jumps
+ * by the given offsets, each row terminated by NO_SQUARE.
+ */
+static void print_targets(const char *name, const int *offset_x,
+                          const int *offset_y) {
+    int square, i, count;
+
+    printf("const unsigned char %s[64][9] = {\n", name);
+    for (square = 0; square < 64; square++) {
+        printf("    {");
+        count = 0;
+        for (i = 0; i < 8; i++) {
+            int x_pos = (square >> 3) + offset_x[i];
+            int y_pos = (square & 0x07) + offset_y[i];
+
+            if (on_board(x_pos, y_pos)) {
+                printf(" %2d,", (x_pos << 3) + y_pos);
+                count++;
+            }
+        }
+        for (; count < 9; count++) {
+            printf(" NO_SQUARE%s", count < 8 ? "," : "");
+        }
+        printf(" }%s\n", square < 63 ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+/*
+ * Piece values and piece-square tables for the evaluation, midgame then
+ * endgame, based on the PeSTO tables. Listed the usual way round: a8 first,
+ * white's side of the board at the bottom, pieces in the order pawn,
+ * knight, bishop, rook, queen, king.
+ */
+static const int midgame_value[6] = { 82, 337, 365, 477, 1025, 0 };
+static const int endgame_value[6] = { 94, 281, 297, 512, 936, 0 };
+
+static const int midgame_table[6][64] = {
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,
+         98, 134,  61,  95,  68, 126,  34, -11,
+         -6,   7,  26,  31,  65,  56,  25, -20,
+        -14,  13,   6,  21,  23,  12,  17, -23,
+        -27,  -2,  -5,  12,  17,   6,  10, -25,
+        -26,  -4,  -4, -10,   3,   3,  33, -12,
+        -35,  -1, -20, -23, -15,  24,  38, -22,
+          0,   0,   0,   0,   0,   0,   0,   0
+    }, {
+       -167, -89, -34, -49,  61, -97, -15,-107,
+        -73, -41,  72,  36,  23,  62,   7, -17,
+        -47,  60,  37,  65,  84, 129,  73,  44,
+         -9,  17,  19,  53,  37,  69,  18,  22,
+        -13,   4,  16,  13,  28,  19,  21,  -8,
+        -23,  -9,  12,  10,  19,  17,  25, -16,
+        -29, -53, -12,  -3,  -1,  18, -14, -19,
+       -105, -21, -58, -33, -17, -28, -19, -23
+    }, {
+        -29,   4, -82, -37, -25, -42,   7,  -8,
+        -26,  16, -18, -13,  30,  59,  18, -47,
+        -16,  37,  43,  40,  35,  50,  37,  -2,
+         -4,   5,  19,  50,  37,  37,   7,  -2,
+         -6,  13,  13,  26,  34,  12,  10,   4,
+          0,  15,  15,  15,  14,  27,  18,  10,
+          4,  15,  16,   0,   7,  21,  33,   1,
+        -33,  -3, -14, -21, -13, -12, -39, -21
+    }, {
+         32,  42,  32,  51,  63,   9,  31,  43,
+         27,  32,  58,  62,  80,  67,  26,  44,
+         -5,  19,  26,  36,  17,  45,  61,  16,
+        -24, -11,   7,  26,  24,  35,  -8, -20,
+        -36, -26, -12,  -1,   9,  -7,   6, -23,
+        -45, -25, -16, -17,   3,   0,  -5, -33,
+        -44, -16, -20,  -9,  -1,  11,  -6, -71,
+        -19, -13,   1,  17,  16,   7, -37, -26
+    }, {
+        -28,   0,  29,  12,  59,  44,  43,  45,
+        -24, -39,  -5,   1, -16,  57,  28,  54,
+        -13, -17,   7,   8,  29,  56,  47,  57,
+        -27, -27, -16, -16,  -1,  17,  -2,   1,
+         -9, -26,  -9, -10,  -2,  -4,   3,  -3,
+        -14,   2, -11,  -2,  -5,   2,  14,   5,
+        -35,  -8,  11,   2,   8,  15,  -3,   1,
+         -1, -18,  -9,  10, -15, -25, -31, -50
+    }, {
+        -65,  23,  16, -15, -56, -34,   2,  13,
+         29,  -1, -20,  -7,  -8,  -4, -38, -29,
+         -9,  24,   2, -16, -20,   6,  22, -22,
+        -17, -20, -12, -27, -30, -25, -14, -36,
+        -49,  -1, -27, -39, -46, -44, -33, -51,
+        -14, -14, -22, -46, -44, -30, -15, -27,
+          1,   7,  -8, -64, -43, -16,   9,   8,
+        -15,  36,  12, -54,   8, -28,  24,  14
+    }
+};
+
+static const int endgame_table[6][64] = {
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,
+        178, 173, 158, 134, 147, 132, 165, 187,
+         94, 100,  85,  67,  56,  53,  82,  84,
+         32,  24,  13,   5,  -2,   4,  17,  17,
+         13,   9,  -3,  -7,  -7,  -8,   3,  -1,
+          4,   7,  -6,   1,   0,  -5,  -1,  -8,
+         13,   8,   8,  10,  13,   0,   2,  -7,
+          0,   0,   0,   0,   0,   0,   0,   0
+    }, {
+        -58, -38, -13, -28, -31, -27, -63, -99,
+        -25,  -8, -25,  -2,  -9, -25, -24, -52,
+        -24, -20,  10,   9,  -1,  -9, -19, -41,
+        -17,   3,  22,  22,  22,  11,   8, -18,
+        -18,  -6,  16,  25,  16,  17,   4, -18,
+        -23,  -3,  -1,  15,  10,  -3, -20, -22,
+        -42, -20, -10,  -5,  -2, -20, -23, -44,
+        -29, -51, -23, -15, -22, -18, -50, -64
+    }, {
+        -14, -21, -11,  -8,  -7,  -9, -17, -24,
+         -8,  -4,   7, -12,  -3, -13,  -4, -14,
+          2,  -8,   0,  -1,  -2,   6,   0,   4,
+         -3,   9,  12,   9,  14,  10,   3,   2,
+         -6,   3,  13,  19,   7,  10,  -3,  -9,
+        -12,  -3,   8,  10,  13,   3,  -7, -15,
+        -14, -18,  -7,  -1,   4,  -9, -15, -27,
+        -23,  -9, -23,  -5,  -9, -16,  -5, -17
+    }, {
+         13,  10,  18,  15,  12,  12,   8,   5,
+         11,  13,  13,  11,  -3,   3,   8,   3,
+          7,   7,   7,   5,   4,  -3,  -5,  -3,
+          4,   3,  13,   1,   2,   1,  -1,   2,
+          3,   5,   8,   4,  -5,  -6,  -8, -11,
+         -4,   0,  -5,  -1,  -7, -12,  -8, -16,
+         -6,  -6,   0,   2,  -9,  -9, -11,  -3,
+         -9,   2,   3,  -1,  -5, -13,   4, -20
+    }, {
+         -9,  22,  22,  27,  27,  19,  10,  20,
+        -17,  20,  32,  41,  58,  25,  30,   0,
+        -20,   6,   9,  49,  47,  35,  19,   9,
+          3,  22,  24,  45,  57,  40,  57,  36,
+        -18,  28,  19,  47,  31,  34,  39,  23,
+        -16, -27,  15,   6,   9,  17,  10,   5,
+        -22, -23, -30, -16, -16, -23, -36, -32,
+        -33, -28, -22, -43,  -5, -32, -20, -41
+    }, {
+        -74, -35, -18, -18, -11,  15,   4, -17,
+        -12,  17,  14,  17,  17,  38,  23,  11,
+         10,  17,  23,  15,  20,  45,  44,  13,
+         -8,  22,  24,  27,  26,  33,  26,   3,
+        -18,  -4,  21,  24,  27,  23,   9, -11,
+        -19,  -3,  11,  21,  23,  16,   7,  -9,
+        -27, -11,   4,  13,  14,   4,  -5, -17,
+        -53, -34, -21, -11, -28, -14, -24, -43
+    }
+};
+
+/*
+ * Position of each of our piece types (pawn, rook, knight, bishop, queen,
+ * king) in the tables above.
+ */
+static const int table_index[6] = { 0, 3, 1, 2, 4, 5 };
+
+/*
+ * Print a [6][64] table of piece value plus square bonus for a white piece,
+ * indexed by our piece type and our square numbering. Our square x * 8 + y
+ * is rank x + 1, file h - y, which lands on entry 63 - square above.
+ */
+static void print_pst(const char *name, const int *value,
+                      const int (*table)[64]) {
+    int type, square;
+
+    printf("const short %s[6][64] = {\n", name);
+    for (type = 0; type < 6; type++) {
+        printf("    {");
+        for (square = 0; square < 64; square++) {
+            printf("%s%5d%s", square % 8 ? "" : "\n       ",
+                   value[table_index[type]] + table[table_index[type]][63 - square],
+                   square < 63 ? "," : "");
+        }
+        printf("\n    }%s\n", type < 5 ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+/*
+ * Fixed-seed xorshift64*, so regenerating the file gives the same keys.
+ */
+static unsigned long long random_state = 0x2545F4914F6CDD1DULL;
+
+static unsigned long long random_key(void) {
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return random_state * 0x2545F4914F6CDD1DULL;
+}
+
+static void print_key(const char *indent, const char *end) {
+    unsigned long long key = random_key();
+
+    printf("%sZOBRIST_KEY(0x%08lXUL, 0x%08lXUL)%s", indent,
+           (unsigned long) (key >> 32), (unsigned long) (key & 0xFFFFFFFFUL),
+           end);
+}
+
+/*
+ * Print the Zobrist keys: one per piece on each square, one per set of
+ * castling rights, one per en passant column and one for black to move.
+ */
+static void print_zobrist(void) {
+    int side, type, square, i;
+
+    printf("const zobrist_t zobrist_pieces[2][6][64] = {\n");
+    for (side = 0; side < 2; side++) {
+        printf("    {\n");
+        for (type = 0; type < 6; type++) {
+            printf("        {\n");
+            for (square = 0; square < 64; square++) {
+                print_key(square % 2 ? " " : "            ",
+                          square == 63 ? "\n" : (square % 2 ? ",\n" : ","));
+            }
+            printf("        }%s\n", type < 5 ? "," : "");
+        }
+        printf("    }%s\n", side < 1 ? "," : "");
+    }
+    printf("};\n\n");
+
+    printf("const zobrist_t zobrist_castling[16] = {\n");
+    for (i = 0; i < 16; i++) {
+        print_key(i % 2 ? " " : "    ", i == 15 ? "\n" : (i % 2 ? ",\n" : ","));
+    }
+    printf("};\n\n");
+
+    printf("const zobrist_t zobrist_en_passant[8] = {\n");
+    for (i = 0; i < 8; i++) {
+        print_key(i % 2 ? " " : "    ", i == 7 ? "\n" : (i % 2 ? ",\n" : ","));
+    }
+    printf("};\n\n");
+
+    printf("const zobrist_t zobrist_side =\n");
+    print_key("    ", ";\n");
+}
+
+int main(void) {
+    int square, i, steps;
+
+    printf("/*\n");
+    printf(" * Eduardo Berg <eb28@rice.edu>\n");
+    printf(" * Logan Lawrence <lcl5@rice.edu>\n");
+    printf(" * Nathaniel Morris <nam6@rice.edu>\n");
+    printf(" *\n");
+    printf(" * Constant lookup tables for the move generators, evaluation and\n");
+    printf(" * position hash.\n");
+    printf(" *\n");
+    printf(" * GENERATED BY tools/gen_chess_tables.c, DO NOT EDIT BY HAND.\n");
+    printf(" */\n");
+    printf("#include <chess_tables.h>\n\n");
+
+    printf("const signed char direction_offset[8] = {");
+    for (i = 0; i < 8; i++) {
+        printf(" %d%s", (direction_x[i] << 3) + direction_y[i],
+               i < 7 ? "," : "");
+    }
+    printf(" };\n\n");
+
+    printf("const unsigned char ray_length[64][8] = {\n");
+    for (square = 0; square < 64; square++) {
+        printf("    {");
+        for (i = 0; i < 8; i++) {
+            int x_pos = square >> 3;
+            int y_pos = square & 0x07;
+
+            for (steps = 0; on_board(x_pos + direction_x[i],
+                                     y_pos + direction_y[i]); steps++) {
+                x_pos += direction_x[i];
+                y_pos += direction_y[i];
+            }
+            printf(" %d%s", steps, i < 7 ? "," : "");
+        }
+        printf(" }%s\n", square < 63 ? "," : "");
+    }
+    printf("};\n\n");
+
+    printf("const unsigned long long square_bit[64] = {\n");
+    for (square = 0; square < 64; square++) {
+        printf("    0x%016llXULL%s\n", 1ULL << square, square < 63 ? "," : "");
+    }
+    printf("};\n\n");
+
+    print_targets("knight_targets", knight_x, knight_y);
+    print_targets("king_targets", direction_x, direction_y);
+
+    print_pst("pst_midgame", midgame_value, midgame_table);
+    print_pst("pst_endgame", endgame_value, endgame_table);
+
+    print_zobrist();
+
+    return 0;
+}
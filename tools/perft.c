@@ -0,0 +1,361 @@
+/*
+ * Eduardo Berg <eb28@rice.edu>
+ * Logan Lawrence <lcl5@rice.edu>
+ * Nathaniel Morris <nam6@rice.edu>
+ *
+ * Host tool that counts the leaf nodes of the legal move tree (perft) with
+ * the same chess_functions.c the board runs, and checks the counts against
+ * the published reference numbers. Run it before and after touching the
+ * move generators: a wrong count means a rule broke, and the nodes per
+ * second give a throughput baseline.
+ *
+ * Build and run from the top of the repository:
+ *     gcc -O2 -pthread -I. -o perft tools/perft.c tools/fen.c chess_functions.c \
+ *         chess_eval.c chess_tables.c
+ *     ./perft                 runs the reference suite
+ *     ./perft -d 3            runs the suite, to depth 3 where counts are known
+ *     ./perft "<fen>" 5       counts one position up to depth 5
+ *     ./perft --threads 8 ... splits the work over 8 threads
+ *
+ * Add -DCHESS_DEBUG to check the incremental hash and scores against a full
+ * recompute after every move made and taken back, and next_legal_move()
+ * against the move lists.
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef CHESS_DEBUG
+#include <assert.h>
+#endif
+
+#include <chess_functions.h>
+#include <chess_eval.h>
+#include "fen.h"
+
+/*
+ * Positions from the standard perft suite, with the depth the suite runs by
+ * default and the node count at every depth it is known for.
+ */
+#define MAX_REFERENCE_DEPTH 7
+
+struct reference {
+    const char *name;
+    const char *fen;
+    int depth;
+    unsigned long long nodes[MAX_REFERENCE_DEPTH];
+};
+
+static const struct reference suite[] = {
+    { "start",
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 5,
+      { 20, 400, 8902, 197281, 4865609, 119060324, 3195901860ULL } },
+    { "kiwipete",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 4,
+      { 48, 2039, 97862, 4085603, 193690690, 8031647685ULL } },
+    { "position 3",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 6,
+      { 14, 191, 2812, 43238, 674624, 11030083, 178633661 } },
+    { "position 4",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 4,
+      { 6, 264, 9467, 422333, 15833292, 706045033 } },
+    { "position 5",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 4,
+      { 44, 1486, 62379, 2103487, 89941194 } },
+    { "position 6",
+      "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 4,
+      { 46, 2079, 89890, 3894594, 164075551, 6923051137ULL } },
+};
+
+#define SUITE_SIZE (sizeof(suite) / sizeof(suite[0]))
+
+/*
+ * Count the leaves of the legal move tree. The last ply is counted straight
+ * from the move list instead of playing every move out. Moves are made and
+ * taken back on the one position, the way the search does it, so a wrong
+ * unmake_move() shows up in the counts too.
+ */
+static unsigned long long perft(chess_position_t *pos, int depth) {
+    move_t moves[MAX_MOVES];
+    chess_undo_t undo;
+    unsigned long long nodes = 0;
+    int num_moves = generate_legal_moves(pos, moves);
+    int i;
+
+#ifdef CHESS_DEBUG
+    {
+        move_t move = 0;
+
+        // the search walks the same moves one at a time
+        for (i = 0; i < num_moves; i++) {
+            move = next_legal_move(pos, move, MOVES_ALL);
+            assert(move == moves[i] && is_legal_move(pos, move));
+        }
+        assert(next_legal_move(pos, move, MOVES_ALL) == 0);
+
+        // and the two stages split them between them
+        for (i = 0, move = 0; (move = next_legal_move(pos, move, MOVES_CAPTURES)) != 0; i++);
+        for (move = 0; (move = next_legal_move(pos, move, MOVES_QUIETS)) != 0; i++);
+        assert(i == num_moves);
+    }
+#endif
+
+    if (depth <= 1) return depth == 1 ? num_moves : 1;
+
+    for (i = 0; i < num_moves; i++) {
+        make_move(pos, moves[i], &undo);
+        nodes += perft(pos, depth - 1);
+        unmake_move(pos, moves[i], &undo);
+    }
+    return nodes;
+}
+
+/*
+ * One subtree of a split perft: the position after the first one or two
+ * plies, and the count of its leaves once a worker has run it.
+ */
+struct task {
+    chess_position_t pos;
+    int depth;
+    unsigned long long nodes;
+};
+
+/*
+ * Each worker owns a contiguous run of the task list. It takes tasks from
+ * the front of its own run, and when that is empty it steals from the back
+ * of another worker's run, so a few heavy subtrees don't leave threads idle.
+ */
+struct worker {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    int head;
+    int tail;
+};
+
+struct pool {
+    struct task *tasks;
+    struct worker *workers;
+    int num_workers;
+};
+
+struct worker_arg {
+    struct pool *pool;
+    int id;
+};
+
+/*
+ * Take the next task from the front of the worker's own run, or from the
+ * back of someone else's.
+ *
+ * Returns: task index, -1 once every run is empty
+ */
+static int next_task(struct pool *pool, int id) {
+    struct worker *worker;
+    int task = -1;
+    int i;
+
+    for (i = 0; i < pool->num_workers && task < 0; i++) {
+        worker = &pool->workers[(id + i) % pool->num_workers];
+
+        pthread_mutex_lock(&worker->lock);
+        if (worker->head < worker->tail) {
+            task = (i == 0) ? worker->head++ : --worker->tail;
+        }
+        pthread_mutex_unlock(&worker->lock);
+    }
+    return task;
+}
+
+static void *worker_main(void *data) {
+    struct worker_arg *arg = data;
+    struct task *task;
+    int index;
+
+    while ((index = next_task(arg->pool, arg->id)) >= 0) {
+        task = &arg->pool->tasks[index];
+        task->nodes = perft(&task->pos, task->depth);
+    }
+    return NULL;
+}
+
+/*
+ * Append one task per legal move, splitting again below each move while
+ * split_plies is more than one.
+ *
+ * Returns: new number of tasks
+ */
+static int add_tasks(struct task *tasks, int num_tasks, chess_position_t *pos,
+                     int depth, int split_plies) {
+    move_t moves[MAX_MOVES];
+    chess_position_t child;
+    int num_moves = generate_legal_moves(pos, moves);
+    int i;
+
+    for (i = 0; i < num_moves; i++) {
+        child = *pos;
+        make_move(&child, moves[i], 0);
+
+        if (split_plies > 1) {
+            num_tasks = add_tasks(tasks, num_tasks, &child, depth - 1,
+                                  split_plies - 1);
+        } else {
+            tasks[num_tasks].pos = child;
+            tasks[num_tasks].depth = depth - 1;
+            tasks[num_tasks++].nodes = 0;
+        }
+    }
+    return num_tasks;
+}
+
+/*
+ * perft() with the first plies split into tasks shared out between
+ * num_threads workers. The counts are added up in task order once every
+ * worker is done, so the result doesn't depend on who ran what.
+ */
+static unsigned long long perft_threaded(chess_position_t *pos, int depth,
+                                         int num_threads) {
+    struct pool pool;
+    struct worker_arg *args;
+    unsigned long long nodes = 0;
+    int split_plies = (depth > 3) ? 2 : 1;
+    int num_tasks;
+    int per_worker;
+    int i;
+
+    if (num_threads < 2 || depth < 3) return perft(pos, depth);
+
+    pool.tasks = malloc(sizeof(struct task) * MAX_MOVES *
+                        (split_plies > 1 ? MAX_MOVES : 1));
+    pool.workers = malloc(sizeof(struct worker) * num_threads);
+    args = malloc(sizeof(struct worker_arg) * num_threads);
+    if (!pool.tasks || !pool.workers || !args) {
+        fprintf(stderr, "perft: out of memory\n");
+        exit(2);
+    }
+
+    num_tasks = add_tasks(pool.tasks, 0, pos, depth, split_plies);
+    pool.num_workers = num_threads;
+    per_worker = (num_tasks + num_threads - 1) / num_threads;
+
+    for (i = 0; i < num_threads; i++) {
+        pthread_mutex_init(&pool.workers[i].lock, NULL);
+        pool.workers[i].head = i * per_worker < num_tasks ? i * per_worker : num_tasks;
+        pool.workers[i].tail = (i + 1) * per_worker < num_tasks ? (i + 1) * per_worker
+                                                                : num_tasks;
+        args[i].pool = &pool;
+        args[i].id = i;
+    }
+    for (i = 0; i < num_threads; i++) {
+        pthread_create(&pool.workers[i].thread, NULL, worker_main, &args[i]);
+    }
+    for (i = 0; i < num_threads; i++) {
+        pthread_join(pool.workers[i].thread, NULL);
+        pthread_mutex_destroy(&pool.workers[i].lock);
+    }
+
+    for (i = 0; i < num_tasks; i++) nodes += pool.tasks[i].nodes;
+
+    free(args);
+    free(pool.workers);
+    free(pool.tasks);
+    return nodes;
+}
+
+static double seconds_now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/*
+ * Run perft at every depth up to max_depth and print one line per depth.
+ * If expected is given, each count is checked against it.
+ *
+ * Returns: number of depths whose count was wrong
+ */
+static int run_position(const char *name, const char *fen, int max_depth,
+                        const unsigned long long *expected, int num_threads) {
+    chess_position_t pos;
+    unsigned long long nodes;
+    double start, elapsed;
+    int failures = 0;
+    int depth;
+
+    if (!load_fen(&pos, fen)) {
+        fprintf(stderr, "perft: can't read position \"%s\"\n", fen);
+        return 1;
+    }
+
+    for (depth = 1; depth <= max_depth; depth++) {
+        start = seconds_now();
+        nodes = perft_threaded(&pos, depth, num_threads);
+        elapsed = seconds_now() - start;
+
+        printf("%-10s  depth %d  %12llu nodes  %8.3f s  %8.2f Mnps", name,
+               depth, nodes, elapsed, elapsed > 0 ? nodes / elapsed / 1e6 : 0.0);
+        if (expected) {
+            if (nodes == expected[depth - 1]) {
+                printf("  ok\n");
+            } else {
+                printf("  FAIL, expected %llu\n", expected[depth - 1]);
+                failures++;
+            }
+        } else {
+            printf("\n");
+        }
+        fflush(stdout);
+    }
+    return failures;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: perft [--threads n] [-d max_depth]\n"
+                    "       perft [--threads n] \"<fen>\" depth\n");
+}
+
+int main(int argc, char **argv) {
+    const char *fen = NULL;
+    int max_depth = 0;
+    int num_threads = 1;
+    int failures = 0;
+    int depth;
+    int known;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            num_threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc && !fen) {
+            max_depth = atoi(argv[++i]);
+        } else if (!fen && !max_depth && i + 1 < argc) {
+            fen = argv[i];
+            max_depth = atoi(argv[++i]);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (num_threads < 1) num_threads = 1;
+
+    if (fen) {
+        return run_position("fen", fen, max_depth, NULL, num_threads) ? 1 : 0;
+    }
+
+    for (i = 0; i < (int) SUITE_SIZE; i++) {
+        for (known = 0; known < MAX_REFERENCE_DEPTH && suite[i].nodes[known];) known++;
+
+        depth = max_depth ? max_depth : suite[i].depth;
+        if (depth > known) depth = known;
+        failures += run_position(suite[i].name, suite[i].fen, depth,
+                                 suite[i].nodes, num_threads);
+    }
+
+    if (failures) {
+        printf("%d count(s) wrong\n", failures);
+        return 1;
+    }
+    printf("all counts match\n");
+    return 0;
+}